@@ -0,0 +1,37 @@
+/**
+ *  \file PhysicsBenchmark.cpp
+ *
+ *  \brief Throughput benchmark of RigidBodyWorld.
+ *
+ *  Runs Physics_Benchmark() single threaded and with every hardware thread and
+ *  prints the bodies simulated per millisecond of both runs.
+ *
+ *  Usage: PhysicsBenchmark [bodyCount] [stepCount]
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Physics/RigidBodyWorld.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+constexpr size_t BENCHMARK_DEFAULT_BODY_COUNT = 1000;
+constexpr size_t BENCHMARK_DEFAULT_STEP_COUNT = 300;
+
+int main(int argc, char* argv[])
+{
+    size_t bodyCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : BENCHMARK_DEFAULT_BODY_COUNT;
+    size_t stepCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : BENCHMARK_DEFAULT_STEP_COUNT;
+    size_t workerCount = std::thread::hardware_concurrency();
+
+    std::cout << "Bodies: " << bodyCount << ", steps: " << stepCount << "\n";
+    std::cout << "0 workers: " << Game::Physics::Physics_Benchmark(bodyCount, stepCount, 0) << " bodies/ms\n";
+    if (workerCount > 1)
+    {
+        std::cout << workerCount << " workers: " << Game::Physics::Physics_Benchmark(bodyCount, stepCount, workerCount) << " bodies/ms\n";
+    }
+    return 0;
+}
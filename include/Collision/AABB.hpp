@@ -0,0 +1,82 @@
+/**
+ *  \file AABB.hpp
+ *
+ *  \brief Header file for axis aligned bounding boxes.
+ *
+ *  AABB tests sit on the hot path of every broadphase, so the whole struct is
+ *  defined inline here.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_AABB_HPP_
+#define COLLISION_AABB_HPP_
+
+#include <algorithm>
+
+#include "Math/Vector2D.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+template <typename T>
+struct AABB
+{
+    AABB() : min(), max()
+    {
+
+    }
+
+    AABB(const Math::Vector2D<T>& p_min, const Math::Vector2D<T>& p_max) : min(p_min), max(p_max)
+    {
+
+    }
+
+    bool Overlaps(const AABB<T>& other) const
+    {
+        return !(max.x < other.min.x || min.x > other.max.x || max.y < other.min.y || min.y > other.max.y);
+    }
+
+    bool Contains(const AABB<T>& other) const
+    {
+        return min.x <= other.min.x && min.y <= other.min.y && max.x >= other.max.x && max.y >= other.max.y;
+    }
+
+    bool Contains(const Math::Vector2D<T>& point) const
+    {
+        return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y;
+    }
+
+    AABB<T> Merge(const AABB<T>& other) const
+    {
+        return AABB<T>(Math::Vector2D<T>(std::min(min.x, other.min.x), std::min(min.y, other.min.y)),
+                       Math::Vector2D<T>(std::max(max.x, other.max.x), std::max(max.y, other.max.y)));
+    }
+
+    AABB<T> Expand(const T margin) const
+    {
+        return AABB<T>(Math::Vector2D<T>(min.x - margin, min.y - margin), Math::Vector2D<T>(max.x + margin, max.y + margin));
+    }
+
+    Math::Vector2D<T> Center() const
+    {
+        return Math::Vector2D<T>((min.x + max.x) / 2, (min.y + max.y) / 2);
+    }
+
+    Math::Vector2D<T> HalfExtents() const
+    {
+        return Math::Vector2D<T>((max.x - min.x) / 2, (max.y - min.y) / 2);
+    }
+
+    Math::Vector2D<T> min, max;
+};
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_AABB_HPP_
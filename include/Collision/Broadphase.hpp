@@ -0,0 +1,59 @@
+/**
+ *  \file Broadphase.hpp
+ *
+ *  \brief Header file for the sweep and prune broadphase.
+ *
+ *  Colliders are kept sorted along x between frames, objects move little from one
+ *  frame to the next so the insertion sort that restores the order is close to linear.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_BROADPHASE_HPP_
+#define COLLISION_BROADPHASE_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Math/Math_Typedef.hpp"
+#include "Collision/Collider.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+template <typename T>
+class SweepAndPrune
+{
+public:
+    // Constructor
+    SweepAndPrune();
+
+    // Pair generation, pairs are ordered by (lower id, higher id). Static colliders are
+    // left out, call Reset() whenever colliders are added or removed. Pairs whose
+    // CollisionFilter rejects them are never emitted.
+    void FindPairs(const Collider<T>* colliders, size_t count, Math::DynamicArray<CandidatePair>& pairs);
+    void Reset();
+
+    // Queries, colliders whose bounds overlap the region as of the last FindPairs(). Static
+    // colliders are left out. Safe to run from several threads at once.
+    void QueryRegion(const Collider<T>* colliders, size_t count, const AABB<T>& region, Math::DynamicArray<uint32_t>& results) const;
+
+    // Broadphase information, overlapping pairs dropped by their CollisionFilter last FindPairs()
+    size_t GetFilteredPairCount() const;
+
+private:
+    Math::DynamicArray<uint32_t> order;
+    size_t colliderCount;
+    size_t filteredPairCount;
+    bool valid;
+};
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_BROADPHASE_HPP_
@@ -0,0 +1,88 @@
+/**
+ *  \file CCD.hpp
+ *
+ *  \brief Header file for continuous collision detection.
+ *
+ *  Swept AABB gives the entry time of a moving box into a static one, TimeOfImpact()
+ *  runs conservative advancement on top of GJK_Distance() for any pair of shapes.
+ *  Both work on linear motion over the step, rotation is treated as constant.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_CCD_HPP_
+#define COLLISION_CCD_HPP_
+
+#include <stdint.h>
+
+#include "Math/Vector2D.hpp"
+#include "Collision/AABB.hpp"
+#include "Collision/Shape.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+constexpr int TOI_MAX_ITERATIONS = 32;
+constexpr double TOI_TOLERANCE = 1e-3;
+
+template <typename T>
+struct SweepResult
+{
+    bool hit;
+    T time;                         // Fraction of the displacement [0, 1]
+    Math::Vector2D<T> normal;       // Face normal of the target that was hit
+};
+
+template <typename T>
+struct TOI_Result
+{
+    bool hit;
+    T time;                         // Time of impact [0, duration]
+    Math::Vector2D<T> normal;       // Unit normal pointing from A to B at impact
+    Math::Vector2D<T> point;        // Contact point at impact
+    int iterations;
+};
+
+template <typename T>
+struct TimeOfImpactEvent
+{
+    uint32_t idA, idB;              // idA is always the fast collider
+    T time;
+    Math::Vector2D<T> normal;
+    Math::Vector2D<T> point;
+};
+
+template <typename T>
+SweepResult<T> CCD_SweptAABB(const AABB<T>& moving, const Math::Vector2D<T>& displacement, const AABB<T>& target);
+/**
+ *  \param moving Box at the start of the motion.
+ *  \param displacement Motion of the box over the step.
+ *  \param target Static box.
+ *
+ *  \brief Slab test of a moving box against a static one.
+ *
+ *  \return Returns the SweepResult, time is the fraction of displacement at first contact.
+ */
+template <typename T>
+TOI_Result<T> CCD_TimeOfImpact(const Shape<T>& a, const Math::Vector2D<T>& velocityA, const Shape<T>& b, const Math::Vector2D<T>& velocityB, const T duration);
+/**
+ *  \param a First Shape at the start of the step.
+ *  \param velocityA Linear velocity of a.
+ *  \param b Second Shape at the start of the step.
+ *  \param velocityB Linear velocity of b.
+ *  \param duration Length of the step.
+ *
+ *  \brief Conservative advancement, earliest time the shapes come within TOI_TOLERANCE.
+ *
+ *  \return Returns the TOI_Result, time is 0 if the shapes already overlap.
+ */
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_CCD_HPP_
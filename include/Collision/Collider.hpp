@@ -0,0 +1,75 @@
+/**
+ *  \file Collider.hpp
+ *
+ *  \brief Header file for the collider record shared by the broadphase and narrowphase.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_COLLIDER_HPP_
+#define COLLISION_COLLIDER_HPP_
+
+#include <stdint.h>
+
+#include "Collision/AABB.hpp"
+#include "Collision/Shape.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+constexpr uint32_t COLLISION_DEFAULT_CATEGORY = 0x00000001;
+constexpr uint32_t COLLISION_ALL_CATEGORIES = 0xFFFFFFFF;
+
+// Two colliders in the same non zero group always collide if the group is positive
+// and never if it is negative, otherwise each one's category must be in the other's mask
+struct CollisionFilter
+{
+    uint32_t categoryBits;
+    uint32_t maskBits;
+    int32_t groupIndex;
+};
+
+inline CollisionFilter CollisionFilter_Default()
+{
+    return { COLLISION_DEFAULT_CATEGORY, COLLISION_ALL_CATEGORIES, 0 };
+}
+
+inline bool CollisionFilter_ShouldCollide(const CollisionFilter& a, const CollisionFilter& b)
+{
+    if (a.groupIndex == b.groupIndex && a.groupIndex != 0)
+    {
+        return a.groupIndex > 0;
+    }
+    return (a.categoryBits & b.maskBits) != 0 && (b.categoryBits & a.maskBits) != 0;
+}
+
+template <typename T>
+struct Collider
+{
+    uint32_t id;
+    Shape<T> shape;
+    AABB<T> bounds;                 // Refreshed from shape by CollisionWorld::Update(), swept for fast colliders
+    Math::Vector2D<T> velocity;     // Only read for fast colliders
+    bool isFast;                    // Opts in to continuous collision detection
+    bool isResting;                 // Static or sleeping, pairs of two resting colliders are skipped
+    bool isStatic;                  // Lives in the static quadtree instead of the sweep
+    bool isTrigger;                 // Reports events but produces no contacts
+    CollisionFilter filter;
+    void* userData;
+};
+
+// Pair of dense collider indices produced by the broadphase
+struct CandidatePair
+{
+    uint32_t a, b;
+};
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_COLLIDER_HPP_
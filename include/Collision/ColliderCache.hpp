@@ -0,0 +1,174 @@
+/**
+ *  \file ColliderCache.hpp
+ *
+ *  \brief Header file for offline collider baking and the binary collider cache.
+ *
+ *  Colliders are extracted from sprite pixels once by ColliderBaker and written to a
+ *  versioned binary file. ColliderCache memory maps that file at runtime and hands out
+ *  pointers straight into the mapping. Images baked with a name (AddImage() uses the
+ *  path) also get a path table entry holding their image hash, so Find(p_path) gets
+ *  to a collider without loading or hashing the image at runtime.
+ *
+ *  File layout (all offsets are in bytes from the start of the file):
+ *  [ColliderCacheHeader][ColliderCacheEntry x entryCount][ColliderCacheVertex pool][uint32_t mask pool]
+ *  [padding to 8][ColliderCachePath x pathCount][char string pool]
+ *  Entries are sorted by imageHash, paths by pathHash.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_COLLIDER_CACHE_HPP_
+#define COLLISION_COLLIDER_CACHE_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "SDL2/SDL.h"
+#include "Math/Math_Typedef.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+constexpr uint32_t COLLIDER_CACHE_MAGIC = 0x43434753; // "SGCC"
+constexpr uint32_t COLLIDER_CACHE_VERSION = 2;
+constexpr uint8_t COLLIDER_DEFAULT_ALPHA_THRESHOLD = 16;
+
+struct ColliderCacheHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t vertexCount;
+    uint32_t maskWordCount;
+    uint32_t pathCount;
+    uint64_t entryTableOffset;
+    uint64_t vertexPoolOffset;
+    uint64_t maskPoolOffset;
+    uint64_t pathTableOffset;
+    uint64_t stringPoolOffset;
+    uint64_t fileSize;
+};
+
+struct ColliderCacheEntry
+{
+    uint64_t imageHash;
+    uint32_t width, height;
+    int32_t boundsX, boundsY, boundsW, boundsH;
+    uint32_t firstVertex, vertexCount;
+    uint32_t firstMaskWord, maskWordsPerRow;
+};
+
+struct ColliderCacheVertex
+{
+    int16_t x, y;
+};
+
+struct ColliderCachePath
+{
+    uint64_t pathHash;              // FNV-1a of the name, checked against the string on lookup
+    uint64_t imageHash;
+    uint32_t nameOffset, nameLength; // Into the string pool, not null terminated
+};
+
+static_assert(sizeof(ColliderCacheHeader) == 72, "ColliderCacheHeader layout changed, bump COLLIDER_CACHE_VERSION");
+static_assert(sizeof(ColliderCacheEntry) == 48, "ColliderCacheEntry layout changed, bump COLLIDER_CACHE_VERSION");
+static_assert(sizeof(ColliderCacheVertex) == 4, "ColliderCacheVertex layout changed, bump COLLIDER_CACHE_VERSION");
+static_assert(sizeof(ColliderCachePath) == 24, "ColliderCachePath layout changed, bump COLLIDER_CACHE_VERSION");
+
+uint64_t ColliderCache_HashSurface(SDL_Surface* surface);
+/**
+ *  \param surface Image to hash, any pixel format.
+ *
+ *  \brief Hashes the pixels of an image (FNV-1a over RGBA32 rows).
+ *
+ *  The baker and the runtime use the same hash, so a surface loaded at runtime
+ *  can be looked up in a ColliderCache.
+ *
+ *  \return Returns the 64 bit image hash, 0 on failure.
+ */
+
+class ColliderBaker
+{
+public:
+    // Constructor
+    ColliderBaker();
+    ColliderBaker(uint8_t alphaThreshold);
+
+    // Baking
+    bool AddSurface(SDL_Surface* surface, const char* p_name = nullptr);
+    bool AddImage(const char* p_path);
+    bool WriteToFile(const char* p_path) const;
+    void Clear();
+
+    // Baker information
+    size_t GetEntryCount() const;
+    size_t GetPathCount() const;
+    uint8_t GetAlphaThreshold() const;
+
+private:
+    struct BakedCollider
+    {
+        ColliderCacheEntry entry;
+        Math::DynamicArray<ColliderCacheVertex> vertices;
+        Math::DynamicArray<uint32_t> mask;
+    };
+
+    Math::DynamicArray<BakedCollider> colliders;
+    Math::DynamicArray<Math::Pair<Math::String, uint64_t>> paths;  // Name and image hash
+    uint8_t alphaThreshold;
+};
+
+class ColliderCache
+{
+public:
+    // Constructor
+    ColliderCache();
+    ColliderCache(const char* p_path);
+    ColliderCache(const ColliderCache&) = delete;
+    ColliderCache& operator=(const ColliderCache&) = delete;
+    // Destructor
+    ~ColliderCache();
+
+    // Mapping
+    bool Open(const char* p_path);
+    void Close();
+
+    // Lookup, every pointer stays valid until Close()
+    const ColliderCacheEntry* Find(uint64_t imageHash) const;
+    const ColliderCacheEntry* Find(const char* p_path) const;       // Name given to the baker, no pixel access
+    const ColliderCacheEntry* Find(SDL_Surface* surface) const;     // Converts and hashes every pixel
+    const ColliderCacheVertex* GetVertices(const ColliderCacheEntry& entry) const;
+    const uint32_t* GetMask(const ColliderCacheEntry& entry) const;
+    bool IsSolid(const ColliderCacheEntry& entry, int x, int y) const;
+
+    // Cache information
+    bool IsOpen() const;
+    uint32_t GetEntryCount() const;
+    uint32_t GetPathCount() const;
+
+private:
+    const unsigned char* data;
+    size_t size;
+    const ColliderCacheHeader* header;
+    const ColliderCacheEntry* entries;
+    const ColliderCacheVertex* vertices;
+    const uint32_t* mask;
+    const ColliderCachePath* paths;
+    const char* strings;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#else
+    int fileDescriptor;
+#endif
+};
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_COLLIDER_CACHE_HPP_
@@ -0,0 +1,77 @@
+/**
+ *  \file CollisionEvent.hpp
+ *
+ *  \brief Header file for collision enter, stay and exit events.
+ *
+ *  The stream is handed the touching pairs of one frame and diffs them against
+ *  the previous frame's pairs. Events end up in one contiguous buffer ordered by
+ *  (idA, idB), valid until the next EndFrame(). Pairs the caller did not test this
+ *  frame, like two sleeping bodies, can be read back with GetTouching() and added
+ *  again so they keep reporting Stay.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_COLLISION_EVENT_HPP_
+#define COLLISION_COLLISION_EVENT_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Math/Math_Typedef.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+enum class CollisionEventType : uint8_t
+{
+    Enter,
+    Stay,
+    Exit
+};
+
+struct CollisionEvent
+{
+    uint32_t idA, idB;              // idA < idB
+    CollisionEventType type;
+    bool isTrigger;                 // At least one of the colliders is a trigger
+};
+
+class CollisionEventStream
+{
+public:
+    // Constructor
+    CollisionEventStream();
+
+    // Frame bracketing, pairs are expected in (idA, idB) order and sorted otherwise
+    void BeginFrame();
+    void AddTouching(uint32_t idA, uint32_t idB, bool isTrigger);
+    void EndFrame();
+    void Clear();
+
+    // Stream information
+    const Math::DynamicArray<CollisionEvent>& GetEvents() const;
+    size_t GetTouchingCount() const;
+    CollisionEvent GetTouching(size_t index) const;     // Pair of the last finished frame, type is Stay
+
+private:
+    struct TouchingPair
+    {
+        uint64_t key;
+        bool isTrigger;
+    };
+
+    Math::DynamicArray<TouchingPair> previous;
+    Math::DynamicArray<TouchingPair> current;
+    Math::DynamicArray<CollisionEvent> events;
+};
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_COLLISION_EVENT_HPP_
@@ -0,0 +1,134 @@
+/**
+ *  \file CollisionWorld.hpp
+ *
+ *  \brief Header file for the collision world.
+ *
+ *  The world owns every collider, runs the broadphase and hands the candidate
+ *  pairs to the parallel narrowphase once per Update(). Collider ids are stable,
+ *  dense indices are not and only live inside one Update().
+ *
+ *  Colliders flagged fast get their bounds swept over velocity * timeStep and every
+ *  candidate pair they are part of runs a time of impact query. Everything else only
+ *  takes the discrete path. Pairs where both colliders are resting never reach the
+ *  narrowphase, they keep whatever touching state they had when they fell asleep.
+ *
+ *  Static colliders stay out of the sweep and go into a quadtree that is only
+ *  rebuilt when one of them is added, removed or moved. Every other collider queries
+ *  it with its bounds to find its static pairs. Both paths drop pairs rejected by
+ *  the colliders' CollisionFilter before any narrowphase work.
+ *
+ *  Every touching pair feeds the event stream, which turns the frame to frame
+ *  difference into enter, stay and exit events. Pairs with a trigger only produce
+ *  events and are left out of GetContacts().
+ *
+ *  Scene queries (ray casts, shape casts and overlap tests) walk the sweep order and
+ *  the static quadtree as the last Update() left them, then test the colliders'
+ *  current shapes exactly. RayCastBatch() spreads many rays over the thread pool.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_COLLISION_WORLD_HPP_
+#define COLLISION_COLLISION_WORLD_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Math/Math_Typedef.hpp"
+#include "Math/Vector2D.hpp"
+#include "Collision/Collider.hpp"
+#include "Collision/Broadphase.hpp"
+#include "Collision/Narrowphase.hpp"
+#include "Collision/Contact.hpp"
+#include "Collision/CCD.hpp"
+#include "Collision/Quadtree.hpp"
+#include "Collision/CollisionEvent.hpp"
+#include "Collision/Raycast.hpp"
+#include "Utils/ThreadPool.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+template <typename T>
+class CollisionWorld
+{
+public:
+    // Constructor
+    CollisionWorld();
+    CollisionWorld(size_t workerCount);
+
+    // Colliders
+    uint32_t AddCollider(const Shape<T>& shape, void* userData = nullptr);
+    uint32_t AddStaticCollider(const Shape<T>& shape, void* userData = nullptr);
+    bool RemoveCollider(uint32_t id);
+    Collider<T>* GetCollider(uint32_t id);
+    const Collider<T>* GetCollider(uint32_t id) const;
+    void SetTransform(uint32_t id, const Math::Vector2D<T>& position, const T rotation);
+    void SetVelocity(uint32_t id, const Math::Vector2D<T>& velocity);
+    void SetFast(uint32_t id, bool fast);
+    void SetResting(uint32_t id, bool resting);
+    void SetFilter(uint32_t id, const CollisionFilter& filter);
+    void SetTrigger(uint32_t id, bool trigger);
+
+    // Simulation
+    void Update();
+    void Update(const T timeStep);
+
+    // Scene queries, each collider is matched against the filter like a pair would be
+    RaycastHit<T> RayCast(const Math::Vector2D<T>& origin, const Math::Vector2D<T>& translation, const CollisionFilter& filter = CollisionFilter_Default()) const;
+    size_t RayCastAll(const Math::Vector2D<T>& origin, const Math::Vector2D<T>& translation, Math::DynamicArray<RaycastHit<T>>& hits,
+                      const CollisionFilter& filter = CollisionFilter_Default()) const;
+    void RayCastBatch(const RaycastInput<T>* rays, size_t count, RaycastHit<T>* hits);
+    RaycastHit<T> ShapeCast(const Shape<T>& shape, const Math::Vector2D<T>& translation, const CollisionFilter& filter = CollisionFilter_Default()) const;
+    size_t QueryOverlap(const Shape<T>& shape, Math::DynamicArray<uint32_t>& ids, const CollisionFilter& filter = CollisionFilter_Default()) const;
+
+    // World information
+    const Math::DynamicArray<CandidatePair>& GetCandidatePairs() const;
+    const Math::DynamicArray<NarrowphaseResult<T>>& GetContacts() const;
+    const Math::DynamicArray<TimeOfImpactEvent<T>>& GetTimeOfImpacts() const;
+    const Math::DynamicArray<CollisionEvent>& GetEvents() const;
+    const Collider<T>* GetColliders() const;
+    size_t GetColliderCount() const;
+    const Quadtree<T>& GetStaticTree() const;
+    ContactCache<T>& GetContactCache();
+    Narrowphase<T>& GetNarrowphase();
+    Utils::ThreadPool& GetThreadPool();
+
+private:
+    void RebuildStaticTree();
+    void FindStaticPairs();
+    void CarryRestingPairs();
+    void QueryCandidates(const AABB<T>& region, Math::DynamicArray<uint32_t>& candidates, Math::DynamicArray<uint32_t>& scratch) const;
+    RaycastHit<T> CastRay(const RaycastInput<T>& ray, Math::DynamicArray<uint32_t>& candidates, Math::DynamicArray<uint32_t>& scratch,
+                          Math::DynamicArray<RaycastHit<T>>* allHits) const;
+
+    Math::DynamicArray<Collider<T>> colliders;
+    Math::UnorderedMap<uint32_t, size_t> indices;
+    uint32_t nextId;
+
+    SweepAndPrune<T> broadphase;
+    Quadtree<T> staticTree;
+    Math::DynamicArray<QuadtreeItem<T>> staticItems;
+    Math::DynamicArray<uint32_t> staticHits;
+    Math::DynamicArray<CandidatePair> staticPairs;
+    bool staticDirty;
+    Narrowphase<T> narrowphase;
+    ContactCache<T> contactCache;
+    Utils::ThreadPool pool;
+
+    Math::DynamicArray<CandidatePair> candidatePairs;
+    Math::DynamicArray<NarrowphaseResult<T>> contacts;
+    Math::DynamicArray<TimeOfImpactEvent<T>> impacts;
+    CollisionEventStream events;
+    Math::DynamicArray<Math::DynamicArray<uint32_t>> queryScratch;  // Two per pool slot, used by RayCastBatch()
+};
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_COLLISION_WORLD_HPP_
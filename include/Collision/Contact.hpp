@@ -0,0 +1,143 @@
+/**
+ *  \file Contact.hpp
+ *
+ *  \brief Header file for contact manifolds and the persistent contact cache.
+ *
+ *  Contact_Generate() turns an overlapping pair into up to two contact points by
+ *  clipping the incident edge against the reference edge. ContactCache keeps one
+ *  ContactPair per shape pair across frames: the GJK simplex, the last separating
+ *  axis and the accumulated impulses of every contact, matched by feature id.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_CONTACT_HPP_
+#define COLLISION_CONTACT_HPP_
+
+#include <stdint.h>
+
+#include "Math/Math_Typedef.hpp"
+#include "Math/Vector2D.hpp"
+#include "Collision/Shape.hpp"
+#include "Collision/GJK.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+constexpr int MAX_MANIFOLD_POINTS = 2;
+
+template <typename T>
+struct ContactPoint
+{
+    Math::Vector2D<T> position;     // World space, halfway between the two surfaces
+    T depth;
+    uint64_t featureId;             // Stable across frames while the same edges touch, 31 bits per edge index
+    T normalImpulse;                // Accumulated by the solver, carried over for warm starting
+    T tangentImpulse;
+};
+
+template <typename T>
+struct ContactManifold
+{
+    ContactManifold() : pointCount(0)
+    {
+
+    }
+
+    Math::Vector2D<T> normal;       // Unit normal pointing from A to B
+    ContactPoint<T> points[MAX_MANIFOLD_POINTS];
+    int pointCount;
+};
+
+template <typename T>
+struct ContactPair
+{
+    uint32_t idA, idB;              // idA < idB, the manifold normal points from idA to idB
+    ContactManifold<T> manifold;
+    GJK_Simplex<T> simplex;
+    Math::Vector2D<T> separatingAxis;
+    bool hasSeparatingAxis;
+    uint64_t lastFrame;
+};
+
+enum class ContactOutcome
+{
+    SeparatedByCachedAxis,
+    Separated,
+    Touching
+};
+
+struct ContactCacheStats
+{
+    uint64_t queries;
+    uint64_t separatingAxisEarlyOuts;
+    uint64_t narrowphaseRuns;
+    uint64_t evictions;
+};
+
+template <typename T>
+bool Contact_Generate(const Shape<T>& a, const Shape<T>& b, GJK_Simplex<T>& simplex, ContactManifold<T>& manifold);
+/**
+ *  \param a First Shape.
+ *  \param b Second Shape.
+ *  \param simplex Warm start simplex for this pair, updated in place.
+ *  \param manifold Receives normal, contact points and depths.
+ *
+ *  \brief Full narrowphase for a pair: GJK, EPA and edge clipping.
+ *
+ *  \return Returns true if the shapes touch, manifold.pointCount is 0 otherwise.
+ */
+
+uint64_t ContactCache_PairKey(uint32_t idA, uint32_t idB);
+/**
+ *  \param idA First shape id.
+ *  \param idB Second shape id.
+ *
+ *  \brief Order independent key of a shape pair.
+ *
+ *  \return Returns the pair key.
+ */
+
+template <typename T>
+class ContactCache
+{
+public:
+    // Constructor
+    ContactCache();
+
+    // Frame bracketing, EndFrame() drops pairs that were not queried this frame
+    void BeginFrame();
+    void EndFrame();
+    void Clear();
+
+    // Queries, Acquire() and Record() must run on one thread. Update() only touches
+    // the pair it is given, so distinct pairs can be updated in parallel.
+    bool Collide(uint32_t idA, const Shape<T>& a, uint32_t idB, const Shape<T>& b);
+    ContactPair<T>& Acquire(uint32_t idA, uint32_t idB);
+    static ContactOutcome Update(ContactPair<T>& pair, const Shape<T>& a, const Shape<T>& b);
+    void Record(ContactOutcome outcome);
+    void Record(const ContactCacheStats& partial);
+    ContactPair<T>* Find(uint32_t idA, uint32_t idB);
+    const ContactPair<T>* Find(uint32_t idA, uint32_t idB) const;
+
+    // Cache information
+    size_t GetPairCount() const;
+    uint64_t GetFrame() const;
+    const ContactCacheStats& GetStats() const;
+    void ResetStats();
+
+private:
+    Math::UnorderedMap<uint64_t, ContactPair<T>> pairs;
+    uint64_t frame;
+    ContactCacheStats stats;
+};
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_CONTACT_HPP_
@@ -0,0 +1,122 @@
+/**
+ *  \file GJK.hpp
+ *
+ *  \brief Header file for the GJK and EPA narrowphase queries.
+ *
+ *  GJK works on the Minkowski difference A - B of two convex shapes through their
+ *  support functions. Keep the GJK_Simplex of a pair between frames and pass it back
+ *  in: the next query starts from the previous simplex and usually finishes in one or
+ *  two iterations.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_GJK_HPP_
+#define COLLISION_GJK_HPP_
+
+#include "Math/Vector2D.hpp"
+#include "Collision/Shape.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+constexpr int GJK_MAX_ITERATIONS = 32;
+constexpr int EPA_MAX_ITERATIONS = 32;
+constexpr double GJK_TOLERANCE = 1e-6;
+constexpr double EPA_TOLERANCE = 1e-4;
+
+template <typename T>
+struct GJK_SimplexVertex
+{
+    Math::Vector2D<T> pointA;       // Support point on A
+    Math::Vector2D<T> pointB;       // Support point on B
+    Math::Vector2D<T> point;        // pointA - pointB
+    Math::Vector2D<T> direction;    // Search direction that produced this vertex, used for warm starting
+    T weight;                       // Barycentric weight of the closest point
+};
+
+template <typename T>
+struct GJK_Simplex
+{
+    GJK_Simplex() : count(0)
+    {
+
+    }
+
+    void Reset()
+    {
+        count = 0;
+    }
+
+    GJK_SimplexVertex<T> vertices[3];
+    int count;
+};
+
+template <typename T>
+struct GJK_Result
+{
+    bool intersecting;
+    T distance;
+    Math::Vector2D<T> pointA;       // Closest point on A
+    Math::Vector2D<T> pointB;       // Closest point on B
+    int iterations;
+};
+
+template <typename T>
+struct EPA_Result
+{
+    bool valid;
+    Math::Vector2D<T> normal;       // Unit normal pointing from A to B
+    T depth;                        // Moving A by -normal * depth separates the shapes
+    Math::Vector2D<T> pointA;       // Deepest point of A inside B
+    Math::Vector2D<T> pointB;       // Deepest point of B inside A
+};
+
+template <typename T>
+bool GJK_Intersect(const Shape<T>& a, const Shape<T>& b, GJK_Simplex<T>& simplex);
+/**
+ *  \param a First Shape.
+ *  \param b Second Shape.
+ *  \param simplex Simplex of the previous query for this pair, updated in place.
+ *
+ *  \brief Boolean GJK, stops as soon as a separating axis is found.
+ *
+ *  \return Returns true if the shapes overlap or touch.
+ *
+ *  \sa GJK_Distance()
+ */
+template <typename T>
+GJK_Result<T> GJK_Distance(const Shape<T>& a, const Shape<T>& b, GJK_Simplex<T>& simplex);
+/**
+ *  \param a First Shape.
+ *  \param b Second Shape.
+ *  \param simplex Simplex of the previous query for this pair, updated in place.
+ *
+ *  \brief Distance and closest points between two shapes.
+ *
+ *  \return Returns the GJK_Result, distance is 0 when the shapes overlap.
+ *
+ *  \sa GJK_Intersect()
+ *  \sa EPA_Penetration()
+ */
+template <typename T>
+EPA_Result<T> EPA_Penetration(const Shape<T>& a, const Shape<T>& b, const GJK_Simplex<T>& simplex);
+/**
+ *  \param a First Shape.
+ *  \param b Second Shape.
+ *  \param simplex Simplex left by GJK_Intersect() or GJK_Distance() for an overlapping pair.
+ *
+ *  \brief Expanding polytope algorithm, finds the minimum translation out of overlap.
+ *
+ *  \return Returns the EPA_Result, valid is false if the shapes do not overlap.
+ */
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_GJK_HPP_
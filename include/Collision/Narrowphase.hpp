@@ -0,0 +1,69 @@
+/**
+ *  \file Narrowphase.hpp
+ *
+ *  \brief Header file for the parallel narrowphase dispatcher.
+ *
+ *  Candidate pairs are cut into contiguous chunks. Each chunk is run by whichever
+ *  thread picks it up and writes into its own result buffer, the buffers are then
+ *  concatenated in chunk order. No locks are taken on the hot path and the output
+ *  order is the input order, whatever the number of threads.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_NARROWPHASE_HPP_
+#define COLLISION_NARROWPHASE_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Math/Math_Typedef.hpp"
+#include "Collision/Collider.hpp"
+#include "Collision/Contact.hpp"
+#include "Utils/ThreadPool.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+constexpr size_t NARROWPHASE_DEFAULT_CHUNK_SIZE = 64;
+
+template <typename T>
+struct NarrowphaseResult
+{
+    uint32_t idA, idB;              // idA < idB, the manifold normal points from idA to idB
+    ContactManifold<T> manifold;
+    bool isTrigger;
+};
+
+template <typename T>
+class Narrowphase
+{
+public:
+    // Constructor
+    Narrowphase();
+    Narrowphase(size_t chunkSize);
+
+    // Dispatch, results only holds touching pairs
+    void Dispatch(const Collider<T>* colliders, const CandidatePair* pairs, size_t pairCount, ContactCache<T>& cache,
+                  Utils::ThreadPool& pool, Math::DynamicArray<NarrowphaseResult<T>>& results);
+
+    // Narrowphase configuration
+    void SetChunkSize(size_t p_chunkSize);
+    size_t GetChunkSize() const;
+
+private:
+    Math::DynamicArray<ContactPair<T>*> states;
+    Math::DynamicArray<Math::DynamicArray<NarrowphaseResult<T>>> chunkResults;
+    Math::DynamicArray<ContactCacheStats> chunkStats;
+    size_t chunkSize;
+};
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_NARROWPHASE_HPP_
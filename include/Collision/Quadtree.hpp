@@ -0,0 +1,92 @@
+/**
+ *  \file Quadtree.hpp
+ *
+ *  \brief Header file for the loose quadtree over mostly static bounds.
+ *
+ *  Every item goes to the deepest level whose cells are at least as large as the
+ *  item and to the cell holding its center, so a node's loose area is twice its
+ *  cell and no item is ever split. Build() sorts the items by Morton code of that
+ *  cell, which leaves them in depth first order: each node owns one contiguous
+ *  range of items and its whole subtree another. Nodes and items live in two flat
+ *  arrays, nothing is allocated per node. Node bounds are fitted to the subtree's
+ *  items rather than the loose cell.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_QUADTREE_HPP_
+#define COLLISION_QUADTREE_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Math/Math_Typedef.hpp"
+#include "Math/Point2D.hpp"
+#include "Math/Morton.hpp"
+#include "Collision/AABB.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+constexpr int QUADTREE_MAX_DEPTH = 10;
+
+template <typename T>
+struct QuadtreeItem
+{
+    AABB<T> bounds;
+    uint32_t id;                    // Caller defined, returned by the queries
+};
+
+template <typename T>
+struct QuadtreeNode
+{
+    AABB<T> bounds;                 // Fitted to every item in the subtree
+    uint32_t firstChild;            // First of 4 contiguous children, 0 for a leaf
+    uint32_t firstItem;             // Items stored at this node start here...
+    uint32_t itemCount;
+    uint32_t subtreeEnd;            // ...and the subtree's items end here
+};
+
+template <typename T>
+class Quadtree
+{
+public:
+    // Constructor
+    Quadtree();
+
+    // Building, the tree is rebuilt from scratch
+    void Build(const QuadtreeItem<T>* p_items, size_t count);
+    void Clear();
+
+    // Queries, safe to run from several threads at once
+    void QueryRegion(const AABB<T>& region, Math::DynamicArray<uint32_t>& results) const;
+    void QueryPoint(const Math::Point2D<T>& point, Math::DynamicArray<uint32_t>& results) const;
+    void QueryRay(const Math::Vector2D<T>& origin, const Math::Vector2D<T>& translation, Math::DynamicArray<uint32_t>& results) const;
+    void QueryNearest(const Math::Point2D<T>& point, size_t k, Math::DynamicArray<uint32_t>& results) const;
+
+    // Tree information
+    size_t GetItemCount() const;
+    size_t GetNodeCount() const;
+    const AABB<T>& GetBounds() const;
+    const QuadtreeItem<T>* GetItems() const;
+    const QuadtreeNode<T>* GetNodes() const;
+
+private:
+    void BuildNode(uint32_t nodeIndex, int depth, uint32_t begin, uint32_t end);
+
+    Math::DynamicArray<QuadtreeNode<T>> nodes;
+    Math::DynamicArray<QuadtreeItem<T>> items;
+    Math::DynamicArray<uint32_t> keys;              // Morton code of the item's cell at max depth, then its depth
+    Math::MortonSorter sorter;
+    AABB<T> bounds;
+};
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_QUADTREE_HPP_
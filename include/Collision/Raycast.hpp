@@ -0,0 +1,67 @@
+/**
+ *  \file Raycast.hpp
+ *
+ *  \brief Header file for ray casts against single shapes.
+ *
+ *  Rays are a segment from origin to origin + translation, hits are reported as
+ *  the fraction of the translation. A ray that starts inside a shape hits it at
+ *  fraction 0 with the normal facing back along the ray. CollisionWorld builds
+ *  its scene queries on top of these.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_RAYCAST_HPP_
+#define COLLISION_RAYCAST_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Math/Vector2D.hpp"
+#include "Collision/Shape.hpp"
+#include "Collision/Collider.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+constexpr size_t RAYCAST_BATCH_SIZE = 64;
+
+template <typename T>
+struct RaycastInput
+{
+    Math::Vector2D<T> origin;
+    Math::Vector2D<T> translation;  // The ray ends at origin + translation
+    CollisionFilter filter;         // Matched against each collider's filter
+};
+
+template <typename T>
+struct RaycastHit
+{
+    bool hit;
+    uint32_t id;                    // Collider id, only set by world queries
+    T fraction;                     // Fraction of the translation [0, 1]
+    Math::Vector2D<T> point;
+    Math::Vector2D<T> normal;       // Unit surface normal at the hit point
+};
+
+template <typename T>
+RaycastHit<T> Raycast_Shape(const Shape<T>& shape, const Math::Vector2D<T>& origin, const Math::Vector2D<T>& translation);
+/**
+ *  \param shape Shape to cast against.
+ *  \param origin Start of the ray.
+ *  \param translation Ray direction and length.
+ *
+ *  \brief Exact ray cast, in the shape's local space for boxes, capsules and polygons.
+ *
+ *  \return Returns the RaycastHit, hit is false if the segment misses the shape.
+ */
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_RAYCAST_HPP_
@@ -0,0 +1,109 @@
+/**
+ *  \file Shape.hpp
+ *
+ *  \brief Header file for convex collision shapes.
+ *
+ *  Every shape is described by its support function, which is all the GJK and
+ *  EPA queries need. Shapes are plain values, polygon vertices are borrowed from
+ *  the caller and must outlive the shape.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef COLLISION_SHAPE_HPP_
+#define COLLISION_SHAPE_HPP_
+
+#include <cstddef>
+
+#include "Math/Vector2D.hpp"
+#include "Collision/AABB.hpp"
+
+namespace Game
+{
+
+namespace Collision
+{
+
+enum class ShapeType
+{
+    Circle,
+    Box,
+    Capsule,
+    Polygon
+};
+
+template <typename T>
+struct Shape
+{
+    Shape();
+
+    Math::Vector2D<T> Support(const Math::Vector2D<T>& direction) const;
+    Math::Vector2D<T> GetCenter() const;
+    AABB<T> ComputeAABB() const;
+    Math::Vector2D<T> GetVertex(const size_t index) const;
+    size_t GetVertexCount() const;
+    void SetRotation(const T angle);
+    void SetPosition(const Math::Vector2D<T>& p_position);
+
+    ShapeType type;
+    Math::Vector2D<T> position;
+    T rotation;
+    Math::Vector2D<T> orientation;              // (cos, sin) of rotation, kept in sync by SetRotation()
+    T radius;                                   // Circle and Capsule radius
+    Math::Vector2D<T> halfExtents;              // Box half size, Capsule uses x as half segment length
+    const Math::Vector2D<T>* vertices;          // Polygon vertices in local space, counter clockwise
+    size_t vertexCount;
+};
+
+template <typename T>
+Shape<T> Shape_Circle(const Math::Vector2D<T>& position, const T radius);
+/**
+ *  \param position Center of the circle.
+ *  \param radius Radius of the circle.
+ *
+ *  \brief Creates a circle shape.
+ *
+ *  \return Returns the Shape.
+ */
+template <typename T>
+Shape<T> Shape_Box(const Math::Vector2D<T>& position, const Math::Vector2D<T>& halfExtents, const T rotation = 0);
+/**
+ *  \param position Center of the box.
+ *  \param halfExtents Half width and half height.
+ *  \param rotation Rotation [Radians].
+ *
+ *  \brief Creates an oriented box shape.
+ *
+ *  \return Returns the Shape.
+ */
+template <typename T>
+Shape<T> Shape_Capsule(const Math::Vector2D<T>& position, const T halfLength, const T radius, const T rotation = 0);
+/**
+ *  \param position Center of the capsule.
+ *  \param halfLength Half length of the inner segment, along local x.
+ *  \param radius Radius around the segment.
+ *  \param rotation Rotation [Radians].
+ *
+ *  \brief Creates a capsule shape.
+ *
+ *  \return Returns the Shape.
+ */
+template <typename T>
+Shape<T> Shape_Polygon(const Math::Vector2D<T>& position, const Math::Vector2D<T>* vertices, const size_t vertexCount, const T rotation = 0);
+/**
+ *  \param position Origin of the polygon.
+ *  \param vertices Convex, counter clockwise local space vertices. Not copied.
+ *  \param vertexCount Number of vertices.
+ *  \param rotation Rotation [Radians].
+ *
+ *  \brief Creates a convex polygon shape.
+ *
+ *  \return Returns the Shape.
+ */
+
+} // namespace Collision
+
+} // namespace Game
+
+#endif // COLLISION_SHAPE_HPP_
@@ -0,0 +1,73 @@
+/** 
+ *  \file Font.hpp
+ *  
+ *  \brief Header file that Font related class.
+ *
+ *  CreateTextTexture() renders a whole string into a new texture, fine for text
+ *  that never changes. Text redrawn every frame should use DrawText(), which goes
+ *  through the font's GlyphAtlas and allocates nothing once its glyphs are cached.
+ *  Page textures belong to one renderer, so the font keeps an atlas per renderer.
+ *  Call ReleaseGlyphAtlas() before destroying a renderer the font has drawn with.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+ 
+#ifndef ENTITY_FONT_HPP_
+#define ENTITY_FONT_HPP_
+
+#include <iostream>
+#include <memory>
+
+#include "SDL2/SDL.h"
+#include "SDL2/SDL_ttf.h"
+#include "Math/Math_Typedef.hpp"
+#include "Graphics/GlyphAtlas.hpp"
+#include "Graphics/SpriteBatch.hpp"
+
+namespace Game
+{
+
+namespace Entity
+{
+
+class Font
+{
+public:
+    // Constructor
+    Font();
+    Font(const char* p_path, int size, bool HAlign, bool VAlign);
+    Font(const Font&) = delete;
+    Font& operator=(const Font&) = delete;
+    // Destructor
+    ~Font();
+
+    // Loading
+    void OpenFont(const char* p_path, int size, bool HAlign, bool VAlign);
+    void Unload();
+
+    // Text rendering
+    SDL_Texture* CreateTextTexture(SDL_Renderer* renderer, const char* p_text, SDL_Color color);
+    void DrawText(Graphics::SpriteBatch& batch, const char* p_text, float x, float y, SDL_Color color, int layer = 0);
+    Graphics::GlyphAtlas* GetGlyphAtlas(SDL_Renderer* renderer);
+    void ReleaseGlyphAtlas(SDL_Renderer* renderer);
+
+    // Font information
+    TTF_Font* GetFont() const;
+    bool GetHAlign() const;
+    bool GetVAlign() const;
+
+private:
+    TTF_Font* font;
+    bool horizontalAlignment;
+    bool verticalAlignment;
+
+    // Created on first use per renderer, all dropped when the font changes
+    Math::UnorderedMap<SDL_Renderer*, std::unique_ptr<Graphics::GlyphAtlas>> glyphAtlases;
+};
+
+} // namespace Entity
+
+} // namespace Game
+
+#endif // ENTITY_FONT_HPP_
@@ -0,0 +1,110 @@
+/**
+ *  \file AsyncImageLoader.hpp
+ *
+ *  \brief Header file for the asynchronous image loader.
+ *
+ *  Load() hands a path to a pool worker which decodes it with IMG_Load() and
+ *  converts it to the texture upload format, then pushes its slot onto a lock-free
+ *  completion queue. Update() runs on the render thread, turns finished surfaces
+ *  into textures and stops once the frame's upload budget is spent, so a level
+ *  full of images streams in over a few frames instead of stalling one.
+ *
+ *  At most ASYNC_LOADER_MAX_IN_FLIGHT images are decoding or waiting for upload,
+ *  further requests wait on the render thread until a slot frees up.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef GRAPHICS_ASYNC_IMAGE_LOADER_HPP_
+#define GRAPHICS_ASYNC_IMAGE_LOADER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <stdint.h>
+
+#include "SDL2/SDL.h"
+#include "Math/Math_Typedef.hpp"
+#include "Utils/MPSCQueue.hpp"
+#include "Utils/ThreadPool.hpp"
+
+namespace Game
+{
+
+namespace Graphics
+{
+
+constexpr size_t ASYNC_LOADER_MAX_IN_FLIGHT = 64;
+constexpr double ASYNC_LOADER_DEFAULT_BUDGET = 2.0;    // Milliseconds of uploads per Update()
+
+// Receives the texture, nullptr if the image failed to load. The callback owns the texture.
+using ImageLoadedCallback = std::function<void(const char* path, SDL_Texture* texture)>;
+
+struct AsyncLoaderStats
+{
+    uint64_t requestCount;
+    uint64_t uploadCount;
+    uint64_t failedCount;
+    uint64_t deferredCount;             // Update() calls that stopped on the budget
+    double lastUpdateMilliseconds;
+};
+
+class AsyncImageLoader
+{
+public:
+    // Constructor
+    AsyncImageLoader(Utils::ThreadPool& p_pool, SDL_Renderer* p_renderer);
+    AsyncImageLoader(const AsyncImageLoader&) = delete;
+    AsyncImageLoader& operator=(const AsyncImageLoader&) = delete;
+    // Destructor
+    ~AsyncImageLoader();
+
+    // Loading, render thread only
+    void Load(const char* path, ImageLoadedCallback callback);
+    size_t Update(double budgetMilliseconds = ASYNC_LOADER_DEFAULT_BUDGET);
+    void Finish();
+
+    // Loader information
+    size_t GetPendingCount() const;
+    bool IsIdle() const;
+    const AsyncLoaderStats& GetStats() const;
+    void ResetStats();
+
+private:
+    struct LoadSlot
+    {
+        Math::String path;
+        ImageLoadedCallback callback;
+        SDL_Surface* surface;           // Written by the worker before the slot is queued
+        Math::String error;             // IMG_GetError() of the worker, SDL errors are per thread
+    };
+
+    struct LoadRequest
+    {
+        Math::String path;
+        ImageLoadedCallback callback;
+    };
+
+    void Dispatch(uint32_t slot);
+    void Upload(uint32_t slot);
+
+    Utils::ThreadPool& pool;
+    SDL_Renderer* renderer;
+
+    Math::DynamicArray<LoadSlot> slots;
+    Math::DynamicArray<uint32_t> freeSlots;
+    std::deque<LoadRequest> waiting;
+    Utils::MPSCQueue completed;
+    std::atomic<size_t> decoding;
+
+    uint64_t frequency;
+    AsyncLoaderStats stats;
+};
+
+} // namespace Graphics
+
+} // namespace Game
+
+#endif // GRAPHICS_ASYNC_IMAGE_LOADER_HPP_
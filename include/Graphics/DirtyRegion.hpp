@@ -0,0 +1,118 @@
+/**
+ *  \file DirtyRegion.hpp
+ *
+ *  \brief Header file for dirty rectangle tracking and the persistent render target.
+ *
+ *  DirtyRegionTracker collects the rectangles that changed since the last frame,
+ *  folding a new rectangle into an existing one when they overlap or their union
+ *  wastes few pixels. Once the dirty area passes a fraction of the screen, or too
+ *  many separate rectangles pile up, it gives up and asks for a full redraw.
+ *
+ *  DirtyRenderTarget keeps the last frame in a target texture and only redraws the
+ *  dirty rectangles into it, each clipped, before copying it to the screen. A frame
+ *  with nothing dirty draws nothing, a menu left alone costs one texture copy.
+ *  Some backends (Direct3D) drop target contents on SDL_RENDER_TARGETS_RESET and
+ *  every texture on SDL_RENDER_DEVICE_RESET, so events must go through HandleEvent().
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef GRAPHICS_DIRTY_REGION_HPP_
+#define GRAPHICS_DIRTY_REGION_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <stdint.h>
+
+#include "SDL2/SDL.h"
+#include "Math/Math_Typedef.hpp"
+
+namespace Game
+{
+
+namespace Graphics
+{
+
+constexpr size_t DIRTY_MAX_RECTS = 32;
+constexpr double DIRTY_FULL_REDRAW_RATIO = 0.5;        // Dirty fraction of the screen that triggers a full redraw
+constexpr int64_t DIRTY_MERGE_SLACK = 32 * 32;          // Extra pixels a merge may add before rects are kept apart
+
+class DirtyRegionTracker
+{
+public:
+    // Constructor
+    DirtyRegionTracker(int p_width, int p_height);
+
+    // Marking, rects are clipped to the screen
+    void MarkDirty(const SDL_Rect& rect);
+    void MarkAll();
+    void Clear();
+    void Resize(int p_width, int p_height);
+
+    // Region information
+    bool IsClean() const;
+    bool IsFullRedraw() const;
+    const Math::DynamicArray<SDL_Rect>& GetRects() const;
+    int64_t GetDirtyArea() const;
+
+    // Configuration
+    void SetFullRedrawRatio(double ratio);
+    double GetFullRedrawRatio() const;
+
+private:
+    void CheckThreshold();
+
+    Math::DynamicArray<SDL_Rect> rects;
+    int width;
+    int height;
+    double fullRedrawRatio;
+    bool isFullRedraw;
+};
+
+struct DirtyRenderStats
+{
+    uint64_t cleanFrames;           // Frames that only copied the target
+    uint64_t partialFrames;
+    uint64_t fullFrames;
+    uint64_t pixelsRedrawn;
+};
+
+class DirtyRenderTarget
+{
+public:
+    // Receives the rect being redrawn, drawing is already clipped to it
+    using DrawCallback = std::function<void(SDL_Renderer* renderer, const SDL_Rect& clip)>;
+
+    // Constructor
+    DirtyRenderTarget(SDL_Renderer* p_renderer, int p_w, int p_h);
+    DirtyRenderTarget(const DirtyRenderTarget&) = delete;
+    DirtyRenderTarget& operator=(const DirtyRenderTarget&) = delete;
+    // Destructor
+    ~DirtyRenderTarget();
+
+    // Rendering, returns true if anything was redrawn
+    bool Render(const DrawCallback& draw);
+    bool Resize(int w, int h);
+    bool HandleEvent(const SDL_Event& event);
+
+    // Target information
+    DirtyRegionTracker& GetTracker();
+    SDL_Texture* GetTexture() const;
+    const DirtyRenderStats& GetStats() const;
+    void ResetStats();
+
+private:
+    void Redraw(const DrawCallback& draw, const SDL_Rect& clip);
+
+    SDL_Renderer* renderer;
+    SDL_Texture* target;
+    DirtyRegionTracker tracker;
+    DirtyRenderStats stats;
+};
+
+} // namespace Graphics
+
+} // namespace Game
+
+#endif // GRAPHICS_DIRTY_REGION_HPP_
@@ -0,0 +1,114 @@
+/**
+ *  \file GameLoop.hpp
+ *
+ *  \brief Header file for the fixed timestep game loop.
+ *
+ *  The simulation advances in fixed ticks fed by an accumulator, rendering runs
+ *  once per frame with the fraction of a tick left over so it can interpolate
+ *  between the last two simulation states. Frames are paced to the window's
+ *  refresh rate with the performance counter: SDL_Delay() sleeps away most of
+ *  the wait and the last GAMELOOP_SPIN_THRESHOLD seconds are spun, which keeps
+ *  the scheduler's wake up jitter out of the frame time.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef GRAPHICS_GAME_LOOP_HPP_
+#define GRAPHICS_GAME_LOOP_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <stdint.h>
+
+#include "SDL2/SDL.h"
+#include "Graphics/Window.hpp"
+#include "Input/Input.hpp"
+
+namespace Game
+{
+
+namespace Graphics
+{
+
+constexpr double GAMELOOP_DEFAULT_TICK_RATE = 60.0;
+constexpr double GAMELOOP_FALLBACK_FRAME_RATE = 60.0;   // Used when the display reports no refresh rate
+constexpr double GAMELOOP_MAX_FRAME_TIME = 0.25;        // Longer frames are clamped so a stall does not snowball
+constexpr double GAMELOOP_SPIN_THRESHOLD = 0.002;
+constexpr size_t GAMELOOP_STATS_WINDOW = 120;
+
+struct FrameStats
+{
+    uint64_t frameCount;
+    uint64_t tickCount;
+    uint64_t droppedTicks;              // Ticks lost to the GAMELOOP_MAX_FRAME_TIME clamp
+    double lastFrameMilliseconds;
+    double averageFrameMilliseconds;    // Over the last GAMELOOP_STATS_WINDOW frames
+    double minFrameMilliseconds;
+    double maxFrameMilliseconds;
+    double framesPerSecond;
+    double lastOvershootMilliseconds;   // How late the last wait woke up
+};
+
+class GameLoop
+{
+public:
+    // Constructor
+    GameLoop(Window& p_window);
+
+    // Callbacks, tick receives the fixed step in seconds, render the interpolation factor [0, 1)
+    void SetTickCallback(std::function<void(double)> callback);
+    void SetRenderCallback(std::function<void(double)> callback);
+    void SetEventCallback(std::function<void(const SDL_Event&)> callback);
+
+    // Input, when set events are pumped in batches through it and its per frame state reset every frame
+    void SetInput(Input::InputSystem* p_input);
+    Input::InputSystem* GetInput() const;
+
+    // Loop configuration, a target frame rate of 0 follows the window's refresh rate
+    void SetTickRate(double ticksPerSecond);
+    double GetTickRate() const;
+    void SetTargetFrameRate(double framesPerSecond);
+    double GetTargetFrameRate() const;
+
+    // Running
+    void Run();
+    bool RunFrame();
+    void Stop();
+    bool IsRunning() const;
+
+    // Loop information
+    const FrameStats& GetStats() const;
+    void ResetStats();
+
+private:
+    void PumpEvents();
+    void WaitUntil(uint64_t target);
+    void RecordFrame(uint64_t frameCounts);
+
+    Window& window;
+    Input::InputSystem* input;
+    std::function<void(double)> onTick;
+    std::function<void(double)> onRender;
+    std::function<void(const SDL_Event&)> onEvent;
+
+    double tickRate;
+    double targetFrameRate;
+    uint64_t frequency;
+    uint64_t previousCounter;
+    uint64_t nextFrameCounter;
+    double accumulator;
+    bool running;
+    bool started;
+
+    double frameHistory[GAMELOOP_STATS_WINDOW];
+    size_t historyCount;
+    size_t historyNext;
+    FrameStats stats;
+};
+
+} // namespace Graphics
+
+} // namespace Game
+
+#endif // GRAPHICS_GAME_LOOP_HPP_
@@ -0,0 +1,95 @@
+/**
+ *  \file GlyphAtlas.hpp
+ *
+ *  \brief Header file for the glyph atlas used to draw text as batched quads.
+ *
+ *  Each glyph of a TTF_Font is rendered once, white, the first time a string uses
+ *  it and copied into a texture page placed by a SkylinePacker. DrawText() then
+ *  lays strings out with the font's advances and kerning and queues one quad per
+ *  glyph on a SpriteBatch, tinted through the vertex color. A label that changes
+ *  every frame costs no surface or texture allocation once its glyphs are cached.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef GRAPHICS_GLYPH_ATLAS_HPP_
+#define GRAPHICS_GLYPH_ATLAS_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "SDL2/SDL.h"
+#include "SDL2/SDL_ttf.h"
+#include "Math/Math_Typedef.hpp"
+#include "Graphics/SpriteBatch.hpp"
+#include "Graphics/TextureAtlas.hpp"
+
+namespace Game
+{
+
+namespace Graphics
+{
+
+constexpr int GLYPH_ATLAS_PAGE_SIZE = 512;
+constexpr uint32_t GLYPH_ATLAS_ASCII_COUNT = 128;      // Codepoints looked up in a flat table
+constexpr uint32_t GLYPH_ATLAS_NO_GLYPH = 0xFFFFFFFF;
+
+struct Glyph
+{
+    SDL_FRect uv;
+    int w, h;                       // Quad size, 0 for glyphs with nothing to draw
+    int advance;
+    int page;
+};
+
+struct GlyphAtlasStats
+{
+    uint64_t glyphsRasterized;
+    uint64_t quadsDrawn;
+    size_t pageCount;
+};
+
+class GlyphAtlas
+{
+public:
+    // Constructor, the font is borrowed and must outlive the atlas
+    GlyphAtlas(TTF_Font* p_font, SDL_Renderer* p_renderer);
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+    // Destructor
+    ~GlyphAtlas();
+
+    // Text, UTF-8, '\n' starts a new line. (x, y) is the top left of the first line
+    void DrawText(SpriteBatch& batch, const char* text, float x, float y, SDL_Color color, int layer = 0);
+    Math::Pair<int, int> MeasureText(const char* text);
+    const Glyph* GetGlyph(uint32_t codepoint);
+    void Clear();
+
+    // Atlas information
+    TTF_Font* GetFont() const;
+    SDL_Renderer* GetRenderer() const;
+    SDL_Texture* GetTexture(int page) const;
+    const GlyphAtlasStats& GetStats() const;
+
+private:
+    uint32_t Rasterize(uint32_t codepoint);
+    int AddPage();
+
+    TTF_Font* font;
+    SDL_Renderer* renderer;
+
+    Math::DynamicArray<Glyph> glyphs;
+    uint32_t asciiGlyphs[GLYPH_ATLAS_ASCII_COUNT];
+    Math::UnorderedMap<uint32_t, uint32_t> otherGlyphs;
+
+    Math::DynamicArray<SDL_Texture*> pages;
+    SkylinePacker packer;           // Places glyphs on the last page only
+    GlyphAtlasStats stats;
+};
+
+} // namespace Graphics
+
+} // namespace Game
+
+#endif // GRAPHICS_GLYPH_ATLAS_HPP_
@@ -0,0 +1,100 @@
+/**
+ *  \file Headless.hpp
+ *
+ *  \brief Header file for headless rendering and pixel comparison.
+ *
+ *  Headless_Init() selects SDL's dummy video driver, so no display or X server is
+ *  needed, and HeadlessTarget renders into a plain SDL_Surface through SDL's
+ *  software renderer. Everything that takes an SDL_Renderer, SpriteBatch included,
+ *  runs unchanged on it and the result can be saved or compared against a
+ *  reference image pixel by pixel, which is what CI and benchmark servers need.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef GRAPHICS_HEADLESS_HPP_
+#define GRAPHICS_HEADLESS_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "SDL2/SDL.h"
+
+namespace Game
+{
+
+namespace Graphics
+{
+
+constexpr Uint32 HEADLESS_PIXEL_FORMAT = SDL_PIXELFORMAT_RGBA32;
+
+struct PixelDiff
+{
+    bool sizeMatches;
+    size_t differentPixels;         // Pixels with a channel off by more than the tolerance
+    int maxDifference;              // Largest channel difference seen
+    SDL_Rect bounds;                // Smallest rect around the different pixels, empty if none
+};
+
+class HeadlessTarget
+{
+public:
+    // Constructor
+    HeadlessTarget(int p_w, int p_h);
+    HeadlessTarget(const HeadlessTarget&) = delete;
+    HeadlessTarget& operator=(const HeadlessTarget&) = delete;
+    // Destructor
+    ~HeadlessTarget();
+
+    // Target
+    bool Resize(int w, int h);
+    void Clear(SDL_Color color);
+    bool SavePNG(const char* path) const;
+
+    // Target information
+    SDL_Renderer* GetRenderer() const;
+    SDL_Surface* GetSurface() const;
+    bool IsValid() const;
+
+private:
+    void Destroy();
+
+    SDL_Surface* surface;
+    SDL_Renderer* renderer;
+};
+
+bool Headless_Init();
+/**
+ *  \brief Initializes SDL video and events on the dummy video driver, then
+ *  SDL_image and SDL_ttf. Use it instead of Init() where there is no display.
+ *
+ *  \return Returns true if every library started.
+ */
+PixelDiff Headless_Compare(SDL_Surface* a, SDL_Surface* b, int tolerance = 0);
+/**
+ *  \param a First image.
+ *  \param b Second image.
+ *  \param tolerance Largest channel difference still counted as equal.
+ *
+ *  \brief Compares two images of any pixel format channel by channel in RGBA.
+ *
+ *  \return Returns the difference, sizeMatches is false and nothing else is
+ *  filled if the sizes differ.
+ */
+PixelDiff Headless_CompareFile(SDL_Surface* image, const char* referencePath, int tolerance = 0);
+/**
+ *  \param image Rendered image, usually HeadlessTarget::GetSurface().
+ *  \param referencePath Reference image loaded with SDL_image.
+ *  \param tolerance Largest channel difference still counted as equal.
+ *
+ *  \brief Loads the reference image and compares the image against it.
+ *
+ *  \return Returns the difference, sizeMatches is false if the reference failed to load.
+ */
+
+} // namespace Graphics
+
+} // namespace Game
+
+#endif // GRAPHICS_HEADLESS_HPP_
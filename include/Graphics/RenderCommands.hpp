@@ -0,0 +1,118 @@
+/**
+ *  \file RenderCommands.hpp
+ *
+ *  \brief Header file for render command buffers and the render queue.
+ *
+ *  Game systems record quads into one RenderCommandBuffer per thread, no locks
+ *  and no SDL calls involved, so recording can run inside ThreadPool::ParallelFor()
+ *  with the worker index picking the buffer. Commands are small POD records naming
+ *  their texture by a 16 bit id from the queue's texture table. Once recording is
+ *  done the render thread calls Sort(), which sorts every buffer by key and merges
+ *  them, and Replay() feeds the result to a SpriteBatch.
+ *
+ *  Keys order by layer, then texture, then a caller given depth. Commands with the
+ *  same key keep the order of their buffers, then their recording order.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef GRAPHICS_RENDER_COMMANDS_HPP_
+#define GRAPHICS_RENDER_COMMANDS_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+#include <type_traits>
+
+#include "SDL2/SDL.h"
+#include "Math/Math_Typedef.hpp"
+#include "Graphics/SpriteBatch.hpp"
+#include "Utils/ThreadPool.hpp"
+
+namespace Game
+{
+
+namespace Graphics
+{
+
+constexpr size_t RENDER_COMMAND_RESERVE = 1024;         // Commands per buffer before the first growth
+constexpr uint16_t RENDER_NO_TEXTURE = 0;               // Untextured quads, filled with the command color
+
+struct RenderCommand
+{
+    uint64_t key;
+    SDL_FRect destination;
+    SDL_FRect uv;
+    float angle;                    // Degrees clockwise around the destination center
+    SDL_Color color;
+    uint16_t texture;               // Id from RenderQueue::RegisterTexture()
+};
+
+static_assert(std::is_trivially_copyable<RenderCommand>::value, "Render commands are copied as plain bytes");
+
+uint64_t RenderCommand_Key(int16_t layer, uint16_t texture, uint32_t depth);
+/**
+ *  \param layer Draw layer, lower layers are drawn first.
+ *  \param texture Texture id, commands sharing one end up next to each other.
+ *  \param depth Order inside a layer and texture.
+ *
+ *  \brief Packs the sort key, layer in the top 16 bits, texture in the next 16
+ *  and depth in the low 32.
+ *
+ *  \return Returns the key.
+ */
+
+class alignas(64) RenderCommandBuffer
+{
+public:
+    // Constructor
+    RenderCommandBuffer();
+
+    // Recording
+    void Draw(uint16_t texture, const SDL_FRect& destination, const SDL_FRect& uv, int16_t layer = 0, SDL_Color color = { 255, 255, 255, 255 }, float angle = 0, uint32_t depth = 0);
+    void FillRect(const SDL_FRect& rect, SDL_Color color, int16_t layer = 0, uint32_t depth = 0);
+    void Reset();
+
+    // Buffer information
+    const RenderCommand* GetCommands() const;
+    size_t GetCount() const;
+
+private:
+    friend class RenderQueue;
+
+    Math::DynamicArray<RenderCommand> commands;
+};
+
+class RenderQueue
+{
+public:
+    // Constructor, one buffer per recording thread, see ThreadPool::GetSlotCount()
+    RenderQueue(size_t bufferCount);
+
+    // Textures, register before recording starts. Id 0 is RENDER_NO_TEXTURE
+    uint16_t RegisterTexture(SDL_Texture* texture);
+    void ClearTextures();
+
+    // Frame
+    void BeginFrame();
+    RenderCommandBuffer* GetBuffer(size_t index);        // nullptr past GetBufferCount(), buffers are never shared
+    void Sort(Utils::ThreadPool* pool = nullptr);
+    size_t Replay(SpriteBatch& batch) const;
+
+    // Queue information
+    size_t GetBufferCount() const;
+    const Math::DynamicArray<RenderCommand>& GetSortedCommands() const;
+
+private:
+    Math::DynamicArray<RenderCommandBuffer> buffers;
+    Math::DynamicArray<SDL_Texture*> textures;
+    Math::UnorderedMap<SDL_Texture*, uint16_t> textureIds;
+    Math::DynamicArray<RenderCommand> sorted;
+    Math::DynamicArray<RenderCommand> scratch;
+};
+
+} // namespace Graphics
+
+} // namespace Game
+
+#endif // GRAPHICS_RENDER_COMMANDS_HPP_
@@ -0,0 +1,145 @@
+/**
+ *  \file ResourceCache.hpp
+ *
+ *  \brief Header file for the reference counted resource cache.
+ *
+ *  Textures, surfaces and fonts are looked up by a 64 bit hash of their type,
+ *  path and font size, so asking twice for the same file loads it once. Callers
+ *  hold a ResourceHandle, an index plus generation that goes stale once its
+ *  resource is freed, and Release() it when done. Resources nobody holds stay
+ *  cached on an LRU list and are only freed, oldest first, when their memory
+ *  pool goes over budget. Textures count against the GPU budget, surfaces and
+ *  fonts against the CPU budget.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef GRAPHICS_RESOURCE_CACHE_HPP_
+#define GRAPHICS_RESOURCE_CACHE_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "SDL2/SDL.h"
+#include "SDL2/SDL_ttf.h"
+#include "Math/Math_Typedef.hpp"
+
+namespace Game
+{
+
+namespace Graphics
+{
+
+constexpr size_t RESOURCE_DEFAULT_GPU_BUDGET = 256u << 20;
+constexpr size_t RESOURCE_DEFAULT_CPU_BUDGET = 128u << 20;
+constexpr uint32_t RESOURCE_INVALID_INDEX = 0xFFFFFFFF;
+
+enum class ResourceType : uint8_t
+{
+    Texture,
+    Surface,
+    Font
+};
+
+enum class ResourceMemory : uint8_t
+{
+    GPU,
+    CPU
+};
+
+struct ResourceHandle
+{
+    uint32_t index = RESOURCE_INVALID_INDEX;
+    uint32_t generation = 0;
+};
+
+struct ResourceCacheStats
+{
+    uint64_t hitCount;
+    uint64_t missCount;
+    uint64_t evictionCount;
+    uint64_t failedCount;
+    size_t residentCount;
+    size_t gpuBytes;
+    size_t cpuBytes;
+};
+
+class ResourceCache
+{
+public:
+    // Constructor
+    ResourceCache(SDL_Renderer* p_renderer);
+    ResourceCache(const ResourceCache&) = delete;
+    ResourceCache& operator=(const ResourceCache&) = delete;
+    // Destructor
+    ~ResourceCache();
+
+    // Loading, every returned handle holds one reference
+    ResourceHandle LoadTexture(const char* path);
+    ResourceHandle LoadSurface(const char* path);
+    ResourceHandle LoadFont(const char* path, int size);
+
+    // References
+    bool Acquire(ResourceHandle handle);
+    bool Release(ResourceHandle handle);
+    bool IsValid(ResourceHandle handle) const;
+
+    // Access, nullptr for a stale handle or a handle of another type
+    SDL_Texture* GetTexture(ResourceHandle handle) const;
+    SDL_Surface* GetSurface(ResourceHandle handle) const;
+    TTF_Font* GetFont(ResourceHandle handle) const;
+
+    // Budget, only resources nobody references are ever evicted
+    void SetBudget(ResourceMemory memory, size_t bytes);
+    size_t GetBudget(ResourceMemory memory) const;
+    size_t GetMemoryUsage(ResourceMemory memory) const;
+    void Trim();
+    void EvictUnused();
+
+    // Cache information
+    const ResourceCacheStats& GetStats() const;
+    void ResetStats();
+
+private:
+    struct ResourceEntry
+    {
+        void* resource;             // nullptr while the slot is free
+        Math::String path;
+        uint64_t key;
+        size_t bytes;
+        uint32_t referenceCount;
+        uint32_t generation;
+        uint32_t previous;          // LRU neighbours, linked only while unreferenced
+        uint32_t next;
+        ResourceType type;
+        int fontSize;
+    };
+
+    ResourceHandle Load(ResourceType type, const char* path, int fontSize);
+    void* Create(ResourceType type, const char* path, int fontSize, size_t& bytes) const;
+    void Destroy(uint32_t index);
+    const ResourceEntry* Find(ResourceHandle handle, ResourceType type) const;
+    void LinkLRU(uint32_t index);
+    void UnlinkLRU(uint32_t index);
+    void Evict(ResourceMemory memory);
+
+    SDL_Renderer* renderer;
+    Math::DynamicArray<ResourceEntry> entries;
+    Math::DynamicArray<uint32_t> freeEntries;
+    Math::UnorderedMap<uint64_t, uint32_t> lookup;
+
+    // Least recently released at the head
+    uint32_t lruHead;
+    uint32_t lruTail;
+
+    size_t budgets[2];
+    size_t usage[2];
+    ResourceCacheStats stats;
+};
+
+} // namespace Graphics
+
+} // namespace Game
+
+#endif // GRAPHICS_RESOURCE_CACHE_HPP_
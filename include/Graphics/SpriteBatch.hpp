@@ -0,0 +1,124 @@
+/**
+ *  \file SpriteBatch.hpp
+ *
+ *  \brief Header file for the sprite batch renderer.
+ *
+ *  Sprites drawn between Begin() and End() are queued, not rendered. End() sorts
+ *  them by layer then texture, writes four vertices per sprite into a vertex array
+ *  allocated once at construction and submits every run of sprites sharing a
+ *  texture with a single SDL_RenderGeometry() call. The index array never changes,
+ *  each call starts at its run's first vertex so the same six indices per quad
+ *  apply to every run. A full queue is flushed early rather than grown.
+ *
+ *  Sprites outside the cull region are rejected in Draw(). Static scenery kept in
+ *  a Collision::Quadtree can be culled as a whole with QueryVisible().
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef GRAPHICS_SPRITE_BATCH_HPP_
+#define GRAPHICS_SPRITE_BATCH_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "SDL2/SDL.h"
+#include "Math/Math_Typedef.hpp"
+#include "Math/Morton.hpp"
+#include "Collision/Quadtree.hpp"
+
+namespace Game
+{
+
+namespace Graphics
+{
+
+constexpr size_t SPRITEBATCH_DEFAULT_CAPACITY = 4096;  // Sprites per flush
+
+enum class SpriteSortMode
+{
+    Deferred,                       // Submission order, only neighbours sharing a texture merge
+    Texture                         // By layer then texture, submission order kept inside each
+};
+
+struct SpriteBatchStats
+{
+    uint64_t spriteCount;           // Sprites drawn
+    uint64_t culledCount;           // Sprites rejected by the cull region
+    uint64_t drawCalls;             // SDL_RenderGeometry() calls submitted
+    uint64_t mergedCount;           // Draw calls saved against one call per sprite
+    uint64_t flushCount;
+};
+
+class SpriteBatch
+{
+public:
+    // Constructor
+    SpriteBatch(SDL_Renderer* p_renderer, size_t p_capacity = SPRITEBATCH_DEFAULT_CAPACITY);
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+    // Batching
+    bool Begin(SpriteSortMode mode = SpriteSortMode::Texture);
+    void Draw(SDL_Texture* texture, const SDL_FRect& destination, const SDL_FRect& uv, int layer = 0, SDL_Color color = { 255, 255, 255, 255 }, float angle = 0);
+    void Draw(SDL_Texture* texture, const SDL_Rect* source, const SDL_FRect& destination, int layer = 0, SDL_Color color = { 255, 255, 255, 255 }, float angle = 0);
+    bool End();
+
+    // Culling, destination rects are tested against the region in Draw()
+    void SetCullRegion(const SDL_FRect& region);
+    void DisableCulling();
+    bool IsCulling() const;
+    void QueryVisible(const Collision::Quadtree<float>& tree, Math::DynamicArray<uint32_t>& results) const;
+
+    // Batch information
+    SDL_Renderer* GetRenderer() const;
+    size_t GetCapacity() const;
+    size_t GetQueuedCount() const;
+    const SpriteBatchStats& GetStats() const;
+    void ResetStats();
+
+private:
+    struct SpriteItem
+    {
+        SDL_Texture* texture;
+        SDL_FRect destination;
+        SDL_FRect uv;
+        SDL_Color color;
+        float angle;                // Degrees clockwise around the destination center
+    };
+
+    void Flush();
+    void WriteQuad(const SpriteItem& item, SDL_Vertex* quad) const;
+    uint32_t GetTextureSlot(SDL_Texture* texture);
+
+    SDL_Renderer* renderer;
+    size_t capacity;
+    bool isDrawing;
+    SpriteSortMode sortMode;
+
+    // Queue, keys are the biased layer in the high half and the texture slot in the low half
+    Math::DynamicArray<SpriteItem> items;
+    Math::DynamicArray<uint64_t> keys;
+    Math::UnorderedMap<SDL_Texture*, uint32_t> textureSlots;
+    Math::MortonSorter sorter;
+
+    // Geometry, sized once for capacity sprites
+    Math::DynamicArray<SDL_Vertex> vertices;
+    Math::DynamicArray<int> indices;
+
+    // Pixel source rects are converted with the size of the last texture queried
+    SDL_Texture* sizedTexture;
+    int textureWidth;
+    int textureHeight;
+
+    SDL_FRect cullRegion;
+    bool isCulling;
+    SpriteBatchStats stats;
+};
+
+} // namespace Graphics
+
+} // namespace Game
+
+#endif // GRAPHICS_SPRITE_BATCH_HPP_
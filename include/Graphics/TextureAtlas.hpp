@@ -0,0 +1,138 @@
+/**
+ *  \file TextureAtlas.hpp
+ *
+ *  \brief Header file for the skyline rectangle packer and texture atlas.
+ *
+ *  SkylinePacker keeps the top edge of everything placed so far as a list of
+ *  horizontal segments and puts each rectangle where its top ends lowest, ties
+ *  going to the narrowest segment. TextureAtlas packs named surfaces into as few
+ *  pages as it can, tallest first, and turns every page into one texture so a
+ *  SpriteBatch can draw whole scenes with a couple of draw calls.
+ *
+ *  Atlases are built at load time with Build() or ahead of time with Save(),
+ *  which writes each page as a PNG next to a text index, and read back with Load().
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef GRAPHICS_TEXTURE_ATLAS_HPP_
+#define GRAPHICS_TEXTURE_ATLAS_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "SDL2/SDL.h"
+#include "Math/Math_Typedef.hpp"
+
+namespace Game
+{
+
+namespace Graphics
+{
+
+constexpr int ATLAS_DEFAULT_PAGE_SIZE = 2048;
+constexpr int ATLAS_DEFAULT_PADDING = 1;    // Transparent pixels around each image, stops filtering bleed
+
+class SkylinePacker
+{
+public:
+    // Constructor
+    SkylinePacker();
+    SkylinePacker(int p_width, int p_height);
+
+    // Packing
+    bool Insert(int w, int h, SDL_Rect& result);
+    void Reset(int p_width, int p_height);
+
+    // Packer information
+    int GetWidth() const;
+    int GetHeight() const;
+    double GetOccupancy() const;
+
+private:
+    struct SkylineSegment
+    {
+        int x, y, width;
+    };
+
+    int Fit(size_t index, int w, int h) const;
+
+    Math::DynamicArray<SkylineSegment> skyline;
+    int width;
+    int height;
+    uint64_t usedArea;
+};
+
+struct AtlasRegion
+{
+    int page;                       // -1 until the atlas is built
+    SDL_Rect rect;                  // Pixels on the page
+    SDL_FRect uv;                   // Normalized, ready for SpriteBatch::Draw()
+    SDL_Texture* texture;           // Page texture, nullptr without a renderer
+};
+
+class TextureAtlas
+{
+public:
+    // Constructor
+    TextureAtlas(int p_pageWidth = ATLAS_DEFAULT_PAGE_SIZE, int p_pageHeight = ATLAS_DEFAULT_PAGE_SIZE, int p_padding = ATLAS_DEFAULT_PADDING);
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+    // Destructor
+    ~TextureAtlas();
+
+    // Sources, surfaces must stay alive until Build() unless the atlas owns them
+    bool AddSurface(const char* name, SDL_Surface* surface, bool takeOwnership = false);
+    bool AddImage(const char* name, const char* path);
+
+    // Building, a null renderer only packs the page surfaces, as an offline tool would
+    bool Build(SDL_Renderer* renderer);
+    bool Save(const char* basePath) const;
+    bool Load(SDL_Renderer* renderer, const char* basePath);
+    void ReleaseSurfaces();
+    void Clear();
+
+    // Lookup
+    const AtlasRegion* Find(const char* name) const;
+    SDL_Texture* GetTexture(int page) const;
+    SDL_Surface* GetSurface(int page) const;
+
+    // Atlas information
+    size_t GetPageCount() const;
+    size_t GetRegionCount() const;
+
+private:
+    struct AtlasSource
+    {
+        SDL_Surface* surface;
+        bool isOwned;
+    };
+
+    struct AtlasPage
+    {
+        SDL_Surface* surface;
+        SDL_Texture* texture;
+        SkylinePacker packer;
+        bool isDirty;                           // Surface changed since the texture was made
+    };
+
+    bool CreateTextures(SDL_Renderer* renderer);
+    void ReleaseSources();
+
+    Math::DynamicArray<Math::String> names;
+    Math::DynamicArray<AtlasRegion> regions;
+    Math::DynamicArray<AtlasSource> sources;    // Parallel to regions until Build()
+    Math::UnorderedMap<Math::String, uint32_t> lookup;
+    Math::DynamicArray<AtlasPage> pages;
+
+    int pageWidth;
+    int pageHeight;
+    int padding;
+};
+
+} // namespace Graphics
+
+} // namespace Game
+
+#endif // GRAPHICS_TEXTURE_ATLAS_HPP_
@@ -59,6 +59,7 @@ public:
     SDL_DisplayMode CreateDisplayMode(int w, int h, int RefreshRate, Uint32 Format);
     void SetDisplayMode(SDL_DisplayMode Mode);
     void Create(const char* p_title, int p_w, int p_h);
+    void Create(const char* p_title, int p_w, int p_h, WindowFlags flags);
     
     // Window resizing and positioning
     void ResizeWindow(int w, int h);
@@ -80,6 +81,7 @@ public:
     void RaiseWindow();
     void ShowMessageBox(const char* p_title, const char* message, MessageType messageType);
     void Update();
+    bool HandleEvent(const SDL_Event& event);
 
     // Window information
     SDL_Window* GetWindow() const;
@@ -100,10 +102,22 @@ public:
     void Destroy();
     
 private:
+    void RefreshState();
+    void RefreshFlags();
+    void RefreshDisplayMode();
+
     SDL_Window* window;
     Math::Point2D<int> windowPos;
     SDL_DisplayMode displayMode;
     bool isWindowModal;
+
+    // Cached state, kept in sync by HandleEvent() so getters never call into SDL
+    Uint32 windowId;
+    Uint32 windowFlags;
+    Math::Pair<int, int> windowSize;
+    int displayIndex;
+    SDL_DisplayMode windowDisplayMode;
+    bool isStateDirty;
 };
 
 } // namepace Graphics
@@ -0,0 +1,161 @@
+/**
+ *  \file Input.hpp
+ *
+ *  \brief Header file for the batched event pump and input state.
+ *
+ *  PumpEvents() drains the SDL queue with SDL_PeepEvents() in batches of
+ *  INPUT_PEEP_BATCH, folds every keyboard, mouse and controller event into state
+ *  bitsets and copies all events into a preallocated ring for whoever still wants
+ *  them. "Is down" and "pressed / released this frame" queries are single bit
+ *  tests, the per frame sets also catch a press and release inside one frame.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef INPUT_INPUT_HPP_
+#define INPUT_INPUT_HPP_
+
+#include <bitset>
+#include <cstddef>
+#include <stdint.h>
+
+#include "SDL2/SDL.h"
+#include "Math/Math_Typedef.hpp"
+
+namespace Game
+{
+
+namespace Input
+{
+
+constexpr size_t INPUT_EVENT_CAPACITY = 1024;
+constexpr int INPUT_PEEP_BATCH = 64;
+constexpr int INPUT_MAX_CONTROLLERS = 4;
+constexpr int INPUT_MOUSE_BUTTONS = 8;
+constexpr int INPUT_CONTROLLER_BUTTONS = SDL_CONTROLLER_BUTTON_MAX;
+constexpr int INPUT_CONTROLLER_AXES = SDL_CONTROLLER_AXIS_MAX;
+
+// Fixed capacity FIFO of SDL events, the oldest event is dropped when full
+class EventRing
+{
+public:
+    // Constructor
+    EventRing();
+
+    // Queue
+    void Push(const SDL_Event& event);
+    bool Pop(SDL_Event& event);
+    void Clear();
+
+    // Ring information
+    size_t GetSize() const;
+    uint64_t GetDroppedCount() const;
+
+private:
+    Math::DynamicArray<SDL_Event> events;
+    size_t head;
+    size_t size;
+    uint64_t droppedCount;
+};
+
+// Three bitsets per device, down now and the edges seen since BeginFrame()
+template <size_t Count>
+struct ButtonState
+{
+    void BeginFrame()
+    {
+        pressed.reset();
+        released.reset();
+    }
+
+    void Set(size_t index, bool isDown)
+    {
+        if (index >= Count || down.test(index) == isDown)
+        {
+            return;
+        }
+        down.set(index, isDown);
+        (isDown ? pressed : released).set(index);
+    }
+
+    std::bitset<Count> down;
+    std::bitset<Count> pressed;
+    std::bitset<Count> released;
+};
+
+struct ControllerState
+{
+    SDL_GameController* controller;
+    SDL_JoystickID instanceId;      // -1 while the slot is free
+    ButtonState<INPUT_CONTROLLER_BUTTONS> buttons;
+    float axes[INPUT_CONTROLLER_AXES]; // [-1, 1], triggers [0, 1]
+};
+
+class InputSystem
+{
+public:
+    // Constructor
+    InputSystem();
+    InputSystem(const InputSystem&) = delete;
+    InputSystem& operator=(const InputSystem&) = delete;
+    // Destructor
+    ~InputSystem();
+
+    // Frame, BeginFrame() clears the per frame edges, PumpEvents() returns the events read
+    void BeginFrame();
+    size_t PumpEvents();
+    void HandleEvent(const SDL_Event& event);
+
+    // Events kept for other consumers, in arrival order
+    bool PollEvent(SDL_Event& event);
+    const EventRing& GetEventRing() const;
+
+    // Keyboard
+    bool IsKeyDown(SDL_Scancode key) const;
+    bool WasKeyPressed(SDL_Scancode key) const;
+    bool WasKeyReleased(SDL_Scancode key) const;
+
+    // Mouse, buttons are SDL_BUTTON_LEFT and friends
+    bool IsMouseButtonDown(int button) const;
+    bool WasMouseButtonPressed(int button) const;
+    bool WasMouseButtonReleased(int button) const;
+    Math::Pair<int, int> GetMousePosition() const;
+    Math::Pair<int, int> GetMouseDelta() const;
+    Math::Pair<float, float> GetMouseWheel() const;
+
+    // Controllers, indexed by slot in connection order
+    bool IsControllerConnected(int slot) const;
+    bool IsControllerButtonDown(int slot, SDL_GameControllerButton button) const;
+    bool WasControllerButtonPressed(int slot, SDL_GameControllerButton button) const;
+    bool WasControllerButtonReleased(int slot, SDL_GameControllerButton button) const;
+    float GetControllerAxis(int slot, SDL_GameControllerAxis axis) const;
+
+    // Input information
+    bool IsQuitRequested() const;
+    uint64_t GetEventCount() const;
+
+private:
+    void AddController(int deviceIndex);
+    void RemoveController(SDL_JoystickID instanceId);
+    ControllerState* FindController(SDL_JoystickID instanceId);
+
+    SDL_Event batch[INPUT_PEEP_BATCH];
+    EventRing ring;
+
+    ButtonState<SDL_NUM_SCANCODES> keys;
+    ButtonState<INPUT_MOUSE_BUTTONS> mouseButtons;
+    Math::Pair<int, int> mousePosition;
+    Math::Pair<int, int> mouseDelta;
+    Math::Pair<float, float> mouseWheel;
+    ControllerState controllers[INPUT_MAX_CONTROLLERS];
+
+    bool isQuitRequested;
+    uint64_t eventCount;
+};
+
+} // namespace Input
+
+} // namespace Game
+
+#endif // INPUT_INPUT_HPP_
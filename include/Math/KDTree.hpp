@@ -0,0 +1,108 @@
+/**
+ *  \file KDTree.hpp
+ *
+ *  \brief Header file for the static kd-tree over Point2D and Point3D arrays.
+ *
+ *  The tree is implicit: Build() reorders a copy of the points so that every
+ *  range's median sits in its middle, with all smaller coordinates on the split
+ *  axis before it. No nodes are stored besides one split axis per element and
+ *  ranges of KDTREE_LEAF_SIZE or fewer points are scanned linearly. Queries
+ *  return indices into the array given to Build().
+ *
+ *  KDTreeRebuilder builds a fresh tree on a pool worker and swaps it in once
+ *  done, so a moving point set can be refreshed every few frames while queries
+ *  keep running on the previous tree.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef MATH_KD_TREE_HPP_
+#define MATH_KD_TREE_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdint.h>
+
+#include "Math/Math_Typedef.hpp"
+#include "Math/Point2D.hpp"
+#include "Math/Point3D.hpp"
+#include "Utils/ThreadPool.hpp"
+
+namespace Game
+{
+
+namespace Math
+{
+
+constexpr size_t KDTREE_LEAF_SIZE = 8;
+
+template <typename Point>
+class KDTree
+{
+public:
+    using Scalar = decltype(Point::x);
+
+    // Constructor
+    KDTree();
+
+    // Building, the tree is rebuilt from scratch
+    void Build(const Point* p_points, size_t count);
+    void Clear();
+
+    // Queries, safe to run from several threads at once
+    void QueryNearest(const Point& point, size_t k, DynamicArray<uint32_t>& results) const;
+    void QueryRadius(const Point& point, const Scalar radius, DynamicArray<uint32_t>& results) const;
+
+    // Tree information
+    size_t GetPointCount() const;
+    bool IsEmpty() const;
+
+private:
+    void BuildRange(const Point* source, size_t begin, size_t end);
+    void NearestRange(size_t begin, size_t end, const Point& point, size_t k, DynamicArray<Pair<Scalar, uint32_t>>& best) const;
+    void RadiusRange(size_t begin, size_t end, const Point& point, const Scalar radiusSquared, DynamicArray<uint32_t>& results) const;
+
+    DynamicArray<Point> points;
+    DynamicArray<uint32_t> ids;     // Index of each reordered point in the Build() input
+    DynamicArray<uint8_t> axes;     // Split axis of the range whose median is this element
+};
+
+template <typename Point>
+class KDTreeRebuilder
+{
+public:
+    // Constructor
+    KDTreeRebuilder(Utils::ThreadPool& p_pool);
+    KDTreeRebuilder(const KDTreeRebuilder&) = delete;
+    KDTreeRebuilder& operator=(const KDTreeRebuilder&) = delete;
+    // Destructor
+    ~KDTreeRebuilder();
+
+    // Rebuilding, points are copied so the caller may change them right after
+    bool BeginRebuild(const Point* points, size_t count);
+    bool Swap();
+
+    // Rebuilder information
+    const KDTree<Point>& GetTree() const;
+    bool IsBuilding() const;
+    uint64_t GetSwapCount() const;
+
+private:
+    Utils::ThreadPool& pool;
+    KDTree<Point> front;
+    KDTree<Point> back;
+    DynamicArray<Point> input;
+    mutable std::mutex mutex;
+    std::condition_variable finished;
+    bool building;
+    bool ready;
+    uint64_t swapCount;
+};
+
+} // namespace Math
+
+} // namespace Game
+
+#endif // MATH_KD_TREE_HPP_
@@ -18,5 +18,7 @@
 #include "Matrix3D.hpp"
 #include "Math_Typedef.hpp"
 #include "Math_Utils.hpp"
+#include "Morton.hpp"
+#include "Polygon.hpp"
 
 #endif // MATH_HPP_
@@ -12,8 +12,11 @@
 #ifndef MATH_UTILS_HPP_
 #define MATH_UTILS_HPP_
 
+#include <algorithm>
 #include <cmath>
 #include <random>
+#include <stdint.h>
+#include <type_traits>
 
 #include "Utils/Exceptions/Math_Exception.hpp"
 
@@ -23,7 +26,7 @@ namespace Math
 {
 	
 // Function to calculate the factorial of a number
-int factorial(int n) {
+inline int factorial(int n) {
     if (n == 0) {
         return 1;
     } else {
@@ -32,7 +35,7 @@ int factorial(int n) {
 }
 
 // Function to calculate the greatest common divisor (GCD) of two numbers
-int GCD(int a, int b) {
+inline int GCD(int a, int b) {
     if (b == 0) {
         return a;
     } else {
@@ -41,59 +44,59 @@ int GCD(int a, int b) {
 }
 
 // Function to calculate the least common multiple (LCM) of two numbers
-int LCM(int a, int b) {
+inline int LCM(int a, int b) {
     return (a * b) / GCD(a, b);
 }
 
 // Function to calculate the square root of a number
-double Sqrt(double x) {
+inline double Sqrt(double x) {
     return std::sqrt(x);
 }
 
 // Function to calculate the sine of an angle in radians
-double Sin(double x) {
+inline double Sin(double x) {
     return std::sin(x);
 }
 
 // Function to calculate the cosine of an angle in radians
-double Cos(double x) {
+inline double Cos(double x) {
     return std::cos(x);
 }
 
 // Function to calculate the tangent of an angle in radians
-double Tan(double x) {
+inline double Tan(double x) {
     return std::tan(x);
 }
 
 // Function to calculate the arcsine of a value (in radians)
-double Arcsin(double x) {
+inline double Arcsin(double x) {
     return std::asin(x);
 }
 
 // Function to calculate the arccosine of a value (in radians)
-double Arccos(double x) {
+inline double Arccos(double x) {
     return std::acos(x);
 }
 
 // Function to calculate the arctangent of a value (in radians)
-double Arctan(double x) {
+inline double Arctan(double x) {
     return std::atan(x);
 }
 	
 // Function to convert degrees to radians
-double RadianToDegree(double radian)
+inline double RadianToDegree(double radian)
 {
 	return radian * (180 / M_PI);
 }
 
 // Function to convert radians to degrees
-double DegreeToRadian(double degree)
+inline double DegreeToRadian(double degree)
 {
 	return degree * (M_PI /180);
 }
 	
 // Function to find logrithims
-double Log(double x, double base = M_E)
+inline double Log(double x, double base = M_E)
 {
     if (x < 0 || base <= 0)
     {
@@ -104,7 +107,7 @@ double Log(double x, double base = M_E)
 }
 
 // Function to find exponential
-double Exponent(double base = M_E, double power = 1)
+inline double Exponent(double base = M_E, double power = 1)
 {
 	return std::pow(base, power);
 }
@@ -133,7 +136,36 @@ T Lerp(T start, T end, float t)
 	return start + (end - start) * t;
 }
 
+// Function to get the random generator state, one generator for the whole program
+// Seeded from std::random_device so every launch differs until SetRandomSeed() is called
+inline uint64_t& RandomState()
+{
+	static uint64_t state = []()
+	{
+	    std::random_device device;
+	    return (static_cast<uint64_t>(device()) << 32) ^ static_cast<uint64_t>(device());
+	}();
+	return state;
+}
+
+// Function to seed the random generator, the same seed gives the same sequence everywhere
+inline void SetRandomSeed(uint64_t seed)
+{
+	RandomState() = seed;
+}
+
+// Function to genrate 64 random bits (SplitMix64), not thread safe
+inline uint64_t GenrateRandomBits()
+{
+	uint64_t value = (RandomState() += 0x9E3779B97F4A7C15ull);
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+	return value ^ (value >> 31);
+}
+
 // Function to genrate random number
+// The standard distributions differ between libraries, the mapping is done by hand so
+// replays and lockstep peers draw the same numbers
 template <typename T>
 T GenrateRandom(T min, T max)
 {
@@ -142,10 +174,27 @@ T GenrateRandom(T min, T max)
 	    Game::Math::Exception::InvalidArgumentException("Min can not be bigger than max");
 	}
 	
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> distr(min, max);
-    return distr(gen);
+	if constexpr (std::is_floating_point<T>::value)
+	{
+	    T unit = static_cast<T>(GenrateRandomBits() >> 11) * static_cast<T>(1.0 / 9007199254740992.0);
+	    return min + (max - min) * unit;
+	}
+	else
+	{
+	    uint64_t range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+	    if (range == 0)
+	    {
+	        return static_cast<T>(GenrateRandomBits());
+	    }
+	    // Rejecting the lowest 2^64 % range values leaves every remainder equally likely
+	    uint64_t threshold = (0 - range) % range;
+	    uint64_t bits = GenrateRandomBits();
+	    while (bits < threshold)
+	    {
+	        bits = GenrateRandomBits();
+	    }
+	    return static_cast<T>(static_cast<uint64_t>(min) + bits % range);
+	}
 }
 	
 } // Math
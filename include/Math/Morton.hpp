@@ -0,0 +1,172 @@
+/**
+ *  \file Morton.hpp
+ *
+ *  \brief Header file for Morton (Z-order) codes and spatial sorting.
+ *
+ *  Interleaves the bits of integer cell coordinates so that cells close in space
+ *  end up close in the code, used to lay out spatial trees in depth first order
+ *  and to reorder entity arrays for cache locality. Encoding uses BMI2 pdep/pext
+ *  when the compiler targets it (__BMI2__) and branch free bit spreading otherwise.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef MATH_MORTON_HPP_
+#define MATH_MORTON_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Math/Math_Typedef.hpp"
+#include "Math/Point2D.hpp"
+#include "Math/Point3D.hpp"
+
+namespace Game
+{
+
+namespace Math
+{
+
+constexpr uint32_t MORTON_MAX_COORDINATE_2D = 0xFFFF;
+constexpr uint32_t MORTON_MAX_COORDINATE_3D = 0x1FFFFF;
+
+uint32_t Morton_Encode2D(uint16_t x, uint16_t y);
+/**
+ *  \param x Cell column.
+ *  \param y Cell row.
+ *
+ *  \brief Interleaves x into the even bits and y into the odd bits.
+ *
+ *  \return Returns the 32 bit Morton code.
+ *
+ *  \sa Morton_Decode2D()
+ */
+void Morton_Decode2D(uint32_t code, uint16_t& x, uint16_t& y);
+/**
+ *  \param code Morton code.
+ *  \param x Receives the cell column.
+ *  \param y Receives the cell row.
+ *
+ *  \brief Inverse of Morton_Encode2D().
+ *
+ *  \sa Morton_Encode2D()
+ */
+uint64_t Morton_Encode3D(uint32_t x, uint32_t y, uint32_t z);
+/**
+ *  \param x Cell x, only the low 21 bits are used.
+ *  \param y Cell y, only the low 21 bits are used.
+ *  \param z Cell z, only the low 21 bits are used.
+ *
+ *  \brief Interleaves x, y and z into every third bit.
+ *
+ *  \return Returns the 63 bit Morton code.
+ *
+ *  \sa Morton_Decode3D()
+ */
+void Morton_Decode3D(uint64_t code, uint32_t& x, uint32_t& y, uint32_t& z);
+/**
+ *  \param code Morton code.
+ *  \param x Receives the cell x.
+ *  \param y Receives the cell y.
+ *  \param z Receives the cell z.
+ *
+ *  \brief Inverse of Morton_Encode3D().
+ *
+ *  \sa Morton_Encode3D()
+ */
+template <typename T>
+uint32_t Morton_Key2D(const Point2D<T>& point, const Point2D<T>& origin, const T cellSize);
+/**
+ *  \param point Point to encode.
+ *  \param origin Corner of cell (0, 0).
+ *  \param cellSize Size of one cell.
+ *
+ *  \brief Quantizes the point to a cell, clamped to the code range, and encodes it.
+ *
+ *  \return Returns the 32 bit Morton code.
+ */
+template <typename T>
+uint64_t Morton_Key3D(const Point3D<T>& point, const Point3D<T>& origin, const T cellSize);
+/**
+ *  \param point Point to encode.
+ *  \param origin Corner of cell (0, 0, 0).
+ *  \param cellSize Size of one cell.
+ *
+ *  \brief Quantizes the point to a cell, clamped to the code range, and encodes it.
+ *
+ *  \return Returns the 63 bit Morton code.
+ */
+
+class MortonSorter
+{
+public:
+    // Constructor
+    MortonSorter();
+
+    // Sorting, stable LSD radix sort on 8 bit digits. Digits every key shares are skipped.
+    void Sort(const uint32_t* keys, size_t count);
+    void Sort(const uint64_t* keys, size_t count);
+
+    // Reorders a lane in place to the last Sort(), call once per lane of a structure of arrays
+    template <typename T>
+    void Apply(T* lane);
+    template <typename T>
+    void Apply(DynamicArray<T>& lane);
+
+    // Sorter information, element i of the sorted order was at GetPermutation()[i]
+    const uint32_t* GetPermutation() const;
+    size_t GetCount() const;
+
+private:
+    template <typename Key>
+    void RadixSort(const Key* keys, size_t count, DynamicArray<Key>& sortedKeys, DynamicArray<Key>& scratchKeys);
+
+    DynamicArray<uint32_t> permutation;
+    DynamicArray<uint32_t> scratch;
+    DynamicArray<uint32_t> keys32[2];
+    DynamicArray<uint64_t> keys64[2];
+    DynamicArray<uint8_t> visited;
+};
+
+// Header defined so any lane type can be reordered
+template <typename T>
+void MortonSorter :: Apply(T* lane)
+{
+    // Follow each cycle of the permutation once, one temporary per cycle
+    size_t count = permutation.size();
+    visited.assign(count, 0);
+    for (size_t start = 0; start < count; start++)
+    {
+        if (visited[start] || permutation[start] == start)
+        {
+            continue;
+        }
+
+        T first = lane[start];
+        size_t current = start;
+        while (permutation[current] != start)
+        {
+            lane[current] = lane[permutation[current]];
+            visited[current] = 1;
+            current = permutation[current];
+        }
+        lane[current] = first;
+        visited[current] = 1;
+    }
+}
+
+template <typename T>
+void MortonSorter :: Apply(DynamicArray<T>& lane)
+{
+    if (lane.size() == permutation.size())
+    {
+        Apply(lane.data());
+    }
+}
+
+} // namespace Math
+
+} // namespace Game
+
+#endif // MATH_MORTON_HPP_
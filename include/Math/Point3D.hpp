@@ -39,7 +39,7 @@ struct Point3D
     bool operator!=(const Point3D<T>& other) const;
 
     double DotProduct(const Point3D<T>& other) const;
-    double CrossProduct(const Point3D<T>& other) const;
+    Point3D<T> CrossProduct(const Point3D<T>& other) const;
     double Magnitude() const;
     Point3D<T> Normalize() const;
     double DistanceFrom(const Point3D<T>& other) const;
@@ -73,7 +73,7 @@ double Point3D_DotProduct(const Point3D<T>& p1, const Point3D<T>& p2);
  *
  */
 template <typename T>
-double Point3D_CrossProduct(const Point3D<T>& p1, const Point3D<T>& p2);
+Point3D<T> Point3D_CrossProduct(const Point3D<T>& p1, const Point3D<T>& p2);
 /**
  *  \param p1 First Point3D.
  *  \param p2 Second Point3D.
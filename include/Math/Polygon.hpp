@@ -0,0 +1,116 @@
+/**
+ *  \file Polygon.hpp
+ *
+ *  \brief Header file for polygon utilities over contiguous Vector2D arrays.
+ *
+ *  Convex hull, area, centroid, inertia, point containment and triangulation.
+ *  Polygons are plain vertex arrays, counter clockwise means a positive signed
+ *  area. Functions that need working memory take it from a caller provided
+ *  ScratchArena and release it before returning, nothing else is allocated.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef MATH_POLYGON_HPP_
+#define MATH_POLYGON_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Math/Vector2D.hpp"
+#include "Utils/ScratchArena.hpp"
+
+namespace Game
+{
+
+namespace Math
+{
+
+template <typename T>
+size_t Polygon_ConvexHull(const Vector2D<T>* points, const size_t count, Vector2D<T>* hull, Utils::ScratchArena& arena);
+/**
+ *  \param points Input points, any order.
+ *  \param count Number of points.
+ *  \param hull Receives the hull, room for count vertices. May not alias points.
+ *  \param arena Scratch memory, needs 3 * count vertices plus alignment.
+ *
+ *  \brief Andrew's monotone chain. The hull is counter clockwise starting at the
+ *  lowest x, collinear points are dropped. The result can be fed to Shape_Polygon().
+ *
+ *  \return Returns the hull vertex count, 0 if the arena ran out.
+ */
+template <typename T>
+T Polygon_SignedArea(const Vector2D<T>* vertices, const size_t count);
+/**
+ *  \param vertices Polygon vertices.
+ *  \param count Number of vertices.
+ *
+ *  \brief Shoelace formula.
+ *
+ *  \return Returns the area, positive for counter clockwise polygons.
+ */
+template <typename T>
+Vector2D<T> Polygon_Centroid(const Vector2D<T>* vertices, const size_t count);
+/**
+ *  \param vertices Simple polygon vertices, either winding.
+ *  \param count Number of vertices.
+ *
+ *  \brief Area weighted centroid, falls back to the vertex average for degenerate polygons.
+ *
+ *  \return Returns the centroid.
+ */
+template <typename T>
+T Polygon_Inertia(const Vector2D<T>* vertices, const size_t count, const T mass);
+/**
+ *  \param vertices Simple polygon vertices, either winding.
+ *  \param count Number of vertices.
+ *  \param mass Mass spread evenly over the area.
+ *
+ *  \brief Moment of inertia about the origin of the vertex coordinates, which is
+ *  the rotation center of a shape. Subtract mass * |centroid|^2 to get it about the centroid.
+ *
+ *  \return Returns the moment of inertia.
+ */
+template <typename T>
+int Polygon_WindingNumber(const Vector2D<T>* vertices, const size_t count, const Vector2D<T>& point);
+/**
+ *  \param vertices Polygon vertices.
+ *  \param count Number of vertices.
+ *  \param point Point to test.
+ *
+ *  \brief Counts how often the polygon winds around the point, without trigonometry.
+ *
+ *  \return Returns the winding number, positive for counter clockwise turns.
+ */
+template <typename T>
+bool Polygon_ContainsPoint(const Vector2D<T>* vertices, const size_t count, const Vector2D<T>& point);
+/**
+ *  \param vertices Polygon vertices.
+ *  \param count Number of vertices.
+ *  \param point Point to test.
+ *
+ *  \brief Non zero winding rule, works for concave and self intersecting polygons.
+ *
+ *  \return Returns true if the point is inside.
+ */
+template <typename T>
+size_t Polygon_Triangulate(const Vector2D<T>* vertices, const size_t count, uint32_t* triangles, Utils::ScratchArena& arena);
+/**
+ *  \param vertices Simple polygon vertices, either winding.
+ *  \param count Number of vertices.
+ *  \param triangles Receives three vertex indices per triangle, room for 3 * (count - 2).
+ *  \param arena Scratch memory, needs about 2 * count indices.
+ *
+ *  \brief Ear clipping. Triangles are counter clockwise whatever the input winding,
+ *  collinear vertices are skipped and self intersecting input stops at the first
+ *  pass without an ear.
+ *
+ *  \return Returns the triangle count, 0 if the arena ran out.
+ */
+
+} // namespace Math
+
+} // namespace Game
+
+#endif // MATH_POLYGON_HPP_
@@ -0,0 +1,223 @@
+/**
+ *  \file RigidBodyWorld.hpp
+ *
+ *  \brief Header file for the 2D rigid body world.
+ *
+ *  Bodies are stored as structure of arrays, one lane per property, indexed by a
+ *  dense body index. Step() advances the world by one fixed time step: collision,
+ *  semi-implicit Euler on velocities, sequential impulses warm started from the
+ *  contact cache, position integration and finally island based sleeping.
+ *  Sleeping and static bodies are marked resting on their collider so pairs between
+ *  them never reach the narrowphase. SortBodies() reorders every lane along a
+ *  Morton curve so bodies that touch are also close in memory.
+ *
+ *  Every stage runs in a fixed order: pairs are sorted by id, the narrowphase only
+ *  computes per pair results and the solver is serial, so the same inputs give bit
+ *  identical results whatever the worker count. Deterministic mode additionally
+ *  hashes the body state after every Step() so replays and lockstep peers can spot
+ *  a desync. Turning it on also seeds Math::GenrateRandom() with
+ *  PHYSICS_DETERMINISTIC_SEED so gameplay randomness replays as well. Builds must
+ *  keep IEEE floating point (no -ffast-math, -ffp-contract=off or /fp:strict, both
+ *  set by the SGC_Core target) and share one libm to stay in sync across machines.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef PHYSICS_RIGID_BODY_WORLD_HPP_
+#define PHYSICS_RIGID_BODY_WORLD_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Math/Math_Typedef.hpp"
+#include "Math/Vector2D.hpp"
+#include "Math/Morton.hpp"
+#include "Collision/Shape.hpp"
+#include "Collision/Contact.hpp"
+#include "Collision/CollisionWorld.hpp"
+
+namespace Game
+{
+
+namespace Physics
+{
+
+constexpr double PHYSICS_DEFAULT_TIME_STEP = 1.0 / 60.0;
+constexpr int PHYSICS_DEFAULT_VELOCITY_ITERATIONS = 8;
+constexpr double PHYSICS_BAUMGARTE = 0.2;
+constexpr double PHYSICS_LINEAR_SLOP = 0.005;
+constexpr double PHYSICS_RESTITUTION_THRESHOLD = 1.0;
+constexpr double PHYSICS_SLEEP_LINEAR_TOLERANCE = 0.01;
+constexpr double PHYSICS_SLEEP_ANGULAR_TOLERANCE = 0.035;
+constexpr double PHYSICS_TIME_TO_SLEEP = 0.5;
+constexpr uint64_t PHYSICS_DETERMINISTIC_SEED = 0x853C49E6748FEA9Bull;
+
+#if defined(__FAST_MATH__)
+constexpr bool PHYSICS_STRICT_FLOATING_POINT = false;
+#else
+constexpr bool PHYSICS_STRICT_FLOATING_POINT = true;
+#endif
+
+template <typename T>
+struct ContactConstraintPoint
+{
+    Math::Vector2D<T> rA, rB;       // Contact point relative to each body center
+    T normalMass;
+    T tangentMass;
+    T bias;                         // Position correction and restitution target velocity
+    T normalImpulse;
+    T tangentImpulse;
+};
+
+template <typename T>
+struct ContactConstraint
+{
+    uint32_t indexA, indexB;        // Dense body indices
+    Math::Vector2D<T> normal;       // Points from A to B
+    ContactConstraintPoint<T> points[Collision::MAX_MANIFOLD_POINTS];
+    int pointCount;
+    T friction;
+    T restitution;
+    Collision::ContactPair<T>* pair; // Impulses are written back here for warm starting
+};
+
+struct PhysicsStepStats
+{
+    uint64_t stepCount;
+    uint64_t bodySteps;             // Sum of body counts over every step
+    size_t awakeBodyCount;
+    size_t constraintCount;
+    size_t islandCount;
+    double lastStepMilliseconds;
+    double totalMilliseconds;
+    uint64_t stateHash;             // Body state after the last step, deterministic mode only
+};
+
+template <typename T>
+class RigidBodyWorld
+{
+public:
+    // Constructor
+    RigidBodyWorld();
+    RigidBodyWorld(size_t workerCount);
+
+    // Bodies, a mass of 0 makes the body static
+    uint32_t AddBody(const Collision::Shape<T>& shape, const T mass);
+    bool RemoveBody(uint32_t id);
+    bool HasBody(uint32_t id) const;
+
+    // Body state
+    void SetPosition(uint32_t id, const Math::Vector2D<T>& position);
+    void SetAngle(uint32_t id, const T angle);
+    void SetVelocity(uint32_t id, const Math::Vector2D<T>& velocity);
+    void SetAngularVelocity(uint32_t id, const T angularVelocity);
+    void SetFriction(uint32_t id, const T friction);
+    void SetRestitution(uint32_t id, const T restitution);
+    void SetAwake(uint32_t id, bool awake);
+    Math::Vector2D<T> GetPosition(uint32_t id) const;
+    T GetAngle(uint32_t id) const;
+    Math::Vector2D<T> GetVelocity(uint32_t id) const;
+    T GetAngularVelocity(uint32_t id) const;
+    bool IsAwake(uint32_t id) const;
+
+    // Forces, cleared after every Step()
+    void ApplyForce(uint32_t id, const Math::Vector2D<T>& force);
+    void ApplyTorque(uint32_t id, const T torque);
+    void ApplyImpulse(uint32_t id, const Math::Vector2D<T>& impulse, const Math::Vector2D<T>& point);
+
+    // Simulation
+    void Step();
+    void SortBodies();
+
+    // World configuration
+    void SetGravity(const Math::Vector2D<T>& p_gravity);
+    const Math::Vector2D<T>& GetGravity() const;
+    void SetTimeStep(const T p_timeStep);
+    T GetTimeStep() const;
+    void SetVelocityIterations(int iterations);
+    int GetVelocityIterations() const;
+    void SetSleepingEnabled(bool enabled);
+    bool IsSleepingEnabled() const;
+    bool SetDeterministic(bool enabled);
+    bool IsDeterministic() const;
+
+    // World information
+    size_t GetBodyCount() const;
+    const uint32_t* GetIds() const;
+    const Math::Vector2D<T>* GetPositions() const;
+    const T* GetAngles() const;
+    const PhysicsStepStats& GetStats() const;
+    double GetBodiesPerMillisecond() const;
+    uint64_t ComputeStateHash() const;
+    void ResetStats();
+    Collision::CollisionWorld<T>& GetCollisionWorld();
+
+private:
+    void WakeBody(size_t index);
+    void SleepBody(size_t index);
+    void BuildConstraints();
+    void SolveVelocities();
+    void UpdateSleep();
+
+    // Body lanes
+    Math::DynamicArray<uint32_t> ids;
+    Math::DynamicArray<Math::Vector2D<T>> positions;
+    Math::DynamicArray<Math::Vector2D<T>> velocities;
+    Math::DynamicArray<Math::Vector2D<T>> forces;
+    Math::DynamicArray<T> angles;
+    Math::DynamicArray<T> angularVelocities;
+    Math::DynamicArray<T> torques;
+    Math::DynamicArray<T> inverseMasses;
+    Math::DynamicArray<T> inverseInertias;
+    Math::DynamicArray<T> frictions;
+    Math::DynamicArray<T> restitutions;
+    Math::DynamicArray<T> sleepTimes;
+    Math::DynamicArray<uint8_t> awake;
+    Math::UnorderedMap<uint32_t, size_t> indices;
+
+    // Spatial sort
+    Math::MortonSorter sorter;
+    Math::DynamicArray<uint32_t> sortKeys;
+
+    // Solver scratch
+    Math::DynamicArray<ContactConstraint<T>> constraints;
+    Math::DynamicArray<uint32_t> islandParents;
+    Math::DynamicArray<T> islandSleepTimes;
+
+    Collision::CollisionWorld<T> collisionWorld;
+    Math::Vector2D<T> gravity;
+    T timeStep;
+    int velocityIterations;
+    bool sleepingEnabled;
+    bool deterministic;
+    PhysicsStepStats stats;
+};
+
+double Physics_Benchmark(size_t bodyCount, size_t stepCount, size_t workerCount);
+/**
+ *  \param bodyCount Number of dynamic boxes dropped on a static ground.
+ *  \param stepCount Number of fixed steps to run.
+ *  \param workerCount Narrowphase worker count.
+ *
+ *  \brief Builds a stacking scene and runs it, the throughput benchmark of the world.
+ *
+ *  \return Returns bodies simulated per millisecond over every step.
+ */
+bool Physics_DeterminismCheck(size_t bodyCount, size_t stepCount, size_t workerCount);
+/**
+ *  \param bodyCount Number of dynamic boxes dropped on a static ground.
+ *  \param stepCount Number of fixed steps to run.
+ *  \param workerCount Narrowphase worker count of the second run.
+ *
+ *  \brief Runs the benchmark scene once single threaded and once with workerCount
+ *  workers in deterministic mode and compares the state hash of every step.
+ *
+ *  \return Returns true if every hash matched, the first mismatch is printed otherwise.
+ */
+
+} // namespace Physics
+
+} // namespace Game
+
+#endif // PHYSICS_RIGID_BODY_WORLD_HPP_
@@ -0,0 +1,61 @@
+/**
+ *  \file MPSCQueue.hpp
+ *
+ *  \brief Header file for the bounded lock-free multi producer, single consumer queue.
+ *
+ *  Every cell carries a sequence number telling producers and the consumer whose
+ *  turn it is, producers claim cells with one compare and swap on the tail and no
+ *  thread ever blocks. Values are 32 bit, typically indices into a slot array the
+ *  owner manages. Push() fails instead of waiting when the queue is full.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef UTILS_MPSC_QUEUE_HPP_
+#define UTILS_MPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdint.h>
+
+namespace Game
+{
+
+namespace Utils
+{
+
+class MPSCQueue
+{
+public:
+    // Constructor, the capacity is rounded up to a power of two
+    MPSCQueue(size_t p_capacity);
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    // Queue, Push() from any thread, Pop() from the owning thread only
+    bool Push(uint32_t value);
+    bool Pop(uint32_t& value);
+
+    // Queue information
+    size_t GetCapacity() const;
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        uint32_t value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+    alignas(64) std::atomic<size_t> tail;    // Next cell producers claim
+    alignas(64) size_t head;                 // Next cell the consumer reads
+};
+
+} // namespace Utils
+
+} // namespace Game
+
+#endif // UTILS_MPSC_QUEUE_HPP_
@@ -0,0 +1,73 @@
+/**
+ *  \file ScratchArena.hpp
+ *
+ *  \brief Header file for the scratch arena, a bump allocator over caller memory.
+ *
+ *  The arena never owns or grows its buffer. Allocate() hands out aligned slices
+ *  and returns nullptr once the buffer is used up, GetMarker() and Release() roll
+ *  back everything allocated after a point so a function can clean up after itself.
+ *  Only trivially copyable data belongs in an arena, nothing is ever destroyed.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef UTILS_SCRATCH_ARENA_HPP_
+#define UTILS_SCRATCH_ARENA_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+#include <type_traits>
+
+namespace Game
+{
+
+namespace Utils
+{
+
+class ScratchArena
+{
+public:
+    // Constructor
+    ScratchArena(void* p_buffer, size_t p_capacity);
+
+    // Allocation, the slice is uninitialized
+    template <typename T>
+    T* Allocate(size_t count);
+    void* AllocateBytes(size_t size, size_t alignment);
+
+    // Rolling back
+    size_t GetMarker() const;
+    void Release(size_t marker);
+    void Reset();
+
+    // Arena information
+    size_t GetUsed() const;
+    size_t GetCapacity() const;
+    size_t GetPeak() const;
+
+private:
+    unsigned char* buffer;
+    size_t capacity;
+    size_t used;
+    size_t peak;
+};
+
+// Header defined so any trivially copyable type can be allocated
+template <typename T>
+T* ScratchArena :: Allocate(size_t count)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "ScratchArena only holds trivially copyable data");
+
+    if (count > (capacity / sizeof(T)))
+    {
+        return nullptr;
+    }
+    return static_cast<T*>(AllocateBytes(count * sizeof(T), alignof(T)));
+}
+
+} // namespace Utils
+
+} // namespace Game
+
+#endif // UTILS_SCRATCH_ARENA_HPP_
@@ -0,0 +1,67 @@
+/**
+ *  \file ThreadPool.hpp
+ *
+ *  \brief Header file for the worker thread pool.
+ *
+ *  ParallelFor() splits a range of tasks over the workers and the calling thread
+ *  and returns once every task ran. Submit() queues a fire and forget job.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#ifndef UTILS_THREAD_POOL_HPP_
+#define UTILS_THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Game
+{
+
+namespace Utils
+{
+
+class ThreadPool
+{
+public:
+    // Constructor
+    ThreadPool();
+    ThreadPool(size_t workerCount);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    // Destructor
+    ~ThreadPool();
+
+    // Work submission
+    void ParallelFor(size_t taskCount, const std::function<void(size_t task, size_t worker)>& function);
+    void Submit(std::function<void()> job);
+    void Wait();
+
+    // Pool information
+    size_t GetWorkerCount() const;
+    size_t GetSlotCount() const;
+
+private:
+    void Start(size_t workerCount);
+    void WorkerLoop(size_t worker);
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void(size_t)>> jobs;
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobsFinished;
+    size_t activeJobs;
+    bool stopping;
+};
+
+} // namespace Utils
+
+} // namespace Game
+
+#endif // UTILS_THREAD_POOL_HPP_
@@ -0,0 +1,189 @@
+/**
+ *  \file AsyncImageLoader.cpp
+ *
+ *  \brief Source file for AsyncImageLoader.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Graphics/AsyncImageLoader.hpp"
+
+#include <iostream>
+#include <thread>
+
+#include "SDL2/SDL_image.h"
+
+Game::Graphics::AsyncImageLoader :: AsyncImageLoader(Utils::ThreadPool& p_pool, SDL_Renderer* p_renderer) : pool(p_pool), renderer(p_renderer),
+    slots(ASYNC_LOADER_MAX_IN_FLIGHT), completed(ASYNC_LOADER_MAX_IN_FLIGHT), decoding(0), frequency(SDL_GetPerformanceFrequency()), stats()
+{
+    freeSlots.reserve(ASYNC_LOADER_MAX_IN_FLIGHT);
+    for (size_t i = ASYNC_LOADER_MAX_IN_FLIGHT; i > 0; i--)
+    {
+        slots[i - 1].surface = nullptr;
+        freeSlots.push_back(static_cast<uint32_t>(i - 1));
+    }
+}
+
+Game::Graphics::AsyncImageLoader :: ~AsyncImageLoader()
+{
+    // Workers still write into slots, wait them out and drop what they made
+    while (decoding.load(std::memory_order_acquire) > 0)
+    {
+        std::this_thread::yield();
+    }
+
+    uint32_t slot;
+    while (completed.Pop(slot))
+    {
+        if (slots[slot].surface != nullptr)
+        {
+            SDL_FreeSurface(slots[slot].surface);
+        }
+    }
+}
+
+void Game::Graphics::AsyncImageLoader :: Load(const char* path, ImageLoadedCallback callback)
+{
+    stats.requestCount++;
+    if (freeSlots.empty())
+    {
+        waiting.push_back(LoadRequest{ path, std::move(callback) });
+        return;
+    }
+
+    uint32_t slot = freeSlots.back();
+    freeSlots.pop_back();
+    slots[slot].path = path;
+    slots[slot].callback = std::move(callback);
+    Dispatch(slot);
+}
+
+size_t Game::Graphics::AsyncImageLoader :: Update(double budgetMilliseconds)
+{
+    uint64_t start = SDL_GetPerformanceCounter();
+    uint64_t budget = static_cast<uint64_t>(budgetMilliseconds * frequency / 1000.0);
+
+    // At least one upload per call so a tiny budget still makes progress
+    size_t uploaded = 0;
+    uint32_t slot;
+    while (completed.Pop(slot))
+    {
+        Upload(slot);
+        uploaded++;
+
+        if (!waiting.empty())
+        {
+            LoadRequest& request = waiting.front();
+            slots[slot].path = std::move(request.path);
+            slots[slot].callback = std::move(request.callback);
+            waiting.pop_front();
+            Dispatch(slot);
+        }
+        else
+        {
+            freeSlots.push_back(slot);
+        }
+
+        if (SDL_GetPerformanceCounter() - start >= budget)
+        {
+            stats.deferredCount++;
+            break;
+        }
+    }
+
+    stats.lastUpdateMilliseconds = static_cast<double>(SDL_GetPerformanceCounter() - start) * 1000.0 / frequency;
+    return uploaded;
+}
+
+void Game::Graphics::AsyncImageLoader :: Finish()
+{
+    while (!IsIdle())
+    {
+        if (Update(0) == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+size_t Game::Graphics::AsyncImageLoader :: GetPendingCount() const
+{
+    return ASYNC_LOADER_MAX_IN_FLIGHT - freeSlots.size() + waiting.size();
+}
+
+bool Game::Graphics::AsyncImageLoader :: IsIdle() const
+{
+    return GetPendingCount() == 0;
+}
+
+const Game::Graphics::AsyncLoaderStats& Game::Graphics::AsyncImageLoader :: GetStats() const
+{
+    return stats;
+}
+
+void Game::Graphics::AsyncImageLoader :: ResetStats()
+{
+    stats = AsyncLoaderStats();
+}
+
+void Game::Graphics::AsyncImageLoader :: Dispatch(uint32_t slot)
+{
+    decoding.fetch_add(1, std::memory_order_relaxed);
+    pool.Submit([this, slot]()
+    {
+        // Converting here leaves the render thread a straight copy into the texture
+        LoadSlot& load = slots[slot];
+        load.surface = IMG_Load(load.path.c_str());
+        if (load.surface == nullptr)
+        {
+            load.error = IMG_GetError();
+        }
+        else if (load.surface->format->format != SDL_PIXELFORMAT_ARGB8888)
+        {
+            SDL_Surface* converted = SDL_ConvertSurfaceFormat(load.surface, SDL_PIXELFORMAT_ARGB8888, 0);
+            if (converted != nullptr)
+            {
+                SDL_FreeSurface(load.surface);
+                load.surface = converted;
+            }
+        }
+
+        // Never full, there are no more slots than cells
+        completed.Push(slot);
+        decoding.fetch_sub(1, std::memory_order_release);
+    });
+}
+
+void Game::Graphics::AsyncImageLoader :: Upload(uint32_t slot)
+{
+    LoadSlot& load = slots[slot];
+    SDL_Texture* texture = nullptr;
+    if (load.surface == nullptr)
+    {
+        std::cerr << "AsyncImageLoader: Can't load " << load.path << ": " << load.error << std::endl;
+        stats.failedCount++;
+    }
+    else
+    {
+        texture = SDL_CreateTextureFromSurface(renderer, load.surface);
+        SDL_FreeSurface(load.surface);
+        load.surface = nullptr;
+        if (texture == nullptr)
+        {
+            std::cerr << "AsyncImageLoader: Can't create texture for " << load.path << ": " << SDL_GetError() << std::endl;
+            stats.failedCount++;
+        }
+        else
+        {
+            stats.uploadCount++;
+        }
+    }
+
+    if (load.callback)
+    {
+        load.callback(load.path.c_str(), texture);
+    }
+    load.callback = nullptr;
+    load.error.clear();
+}
@@ -0,0 +1,150 @@
+/**
+ *  \file Broadphase.cpp
+ *
+ *  \brief Source file for Broadphase.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/Broadphase.hpp"
+
+#include <algorithm>
+
+template <typename T>
+Game::Collision::SweepAndPrune<T> :: SweepAndPrune() : colliderCount(0), filteredPairCount(0), valid(false)
+{
+
+}
+
+template <typename T>
+void Game::Collision::SweepAndPrune<T> :: FindPairs(const Collider<T>* colliders, size_t count, Math::DynamicArray<CandidatePair>& pairs)
+{
+    pairs.clear();
+    filteredPairCount = 0;
+
+    if (!valid || colliderCount != count)
+    {
+        order.clear();
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!colliders[i].isStatic)
+            {
+                order.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        colliderCount = count;
+        valid = true;
+        std::sort(order.begin(), order.end(), [colliders](uint32_t a, uint32_t b)
+        {
+            return colliders[a].bounds.min.x < colliders[b].bounds.min.x;
+        });
+    }
+    else
+    {
+        // Insertion sort, nearly sorted from last frame
+        for (size_t i = 1; i < order.size(); i++)
+        {
+            uint32_t current = order[i];
+            T key = colliders[current].bounds.min.x;
+            size_t j = i;
+            while (j > 0 && colliders[order[j - 1]].bounds.min.x > key)
+            {
+                order[j] = order[j - 1];
+                j--;
+            }
+            order[j] = current;
+        }
+    }
+
+    size_t sweepCount = order.size();
+    for (size_t i = 0; i < sweepCount; i++)
+    {
+        const Collider<T>& first = colliders[order[i]];
+        for (size_t j = i + 1; j < sweepCount; j++)
+        {
+            const Collider<T>& second = colliders[order[j]];
+            if (second.bounds.min.x > first.bounds.max.x)
+            {
+                break;
+            }
+            if (second.bounds.max.y < first.bounds.min.y || second.bounds.min.y > first.bounds.max.y)
+            {
+                continue;
+            }
+            if (first.isResting && second.isResting)
+            {
+                continue;
+            }
+            if (!CollisionFilter_ShouldCollide(first.filter, second.filter))
+            {
+                filteredPairCount++;
+                continue;
+            }
+
+            if (first.id < second.id)
+            {
+                pairs.push_back({ order[i], order[j] });
+            }
+            else
+            {
+                pairs.push_back({ order[j], order[i] });
+            }
+        }
+    }
+
+    // Independent of insertion order and tie breaking in the sweep
+    std::sort(pairs.begin(), pairs.end(), [colliders](const CandidatePair& p, const CandidatePair& q)
+    {
+        return colliders[p.a].id < colliders[q.a].id || (colliders[p.a].id == colliders[q.a].id && colliders[p.b].id < colliders[q.b].id);
+    });
+}
+
+template <typename T>
+void Game::Collision::SweepAndPrune<T> :: Reset()
+{
+    order.clear();
+    valid = false;
+}
+
+template <typename T>
+void Game::Collision::SweepAndPrune<T> :: QueryRegion(const Collider<T>* colliders, size_t count, const AABB<T>& region, Math::DynamicArray<uint32_t>& results) const
+{
+    results.clear();
+
+    // Colliders were added or removed since the last sweep, the order is stale
+    if (!valid || colliderCount != count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!colliders[i].isStatic && region.Overlaps(colliders[i].bounds))
+            {
+                results.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        return;
+    }
+
+    // Sorted by min x, everything past the region's max x cannot overlap
+    for (uint32_t index : order)
+    {
+        const AABB<T>& bounds = colliders[index].bounds;
+        if (bounds.min.x > region.max.x)
+        {
+            break;
+        }
+        if (region.Overlaps(bounds))
+        {
+            results.push_back(index);
+        }
+    }
+}
+
+template <typename T>
+size_t Game::Collision::SweepAndPrune<T> :: GetFilteredPairCount() const
+{
+    return filteredPairCount;
+}
+
+template class Game::Collision::SweepAndPrune<float>;
+template class Game::Collision::SweepAndPrune<double>;
@@ -0,0 +1,136 @@
+/**
+ *  \file CCD.cpp
+ *
+ *  \brief Source file for CCD.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/CCD.hpp"
+#include "Collision/GJK.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using Game::Math::Vector2D;
+
+template <typename T>
+static bool SlabTest(const T movingMin, const T movingMax, const T targetMin, const T targetMax, const T delta, T& entry, T& exit)
+{
+    if (delta == 0)
+    {
+        entry = -std::numeric_limits<T>::max();
+        exit = std::numeric_limits<T>::max();
+        return !(movingMax < targetMin || movingMin > targetMax);
+    }
+
+    T inverse = 1 / delta;
+    T first = (targetMin - movingMax) * inverse;
+    T second = (targetMax - movingMin) * inverse;
+    entry = std::min(first, second);
+    exit = std::max(first, second);
+    return true;
+}
+
+template <typename T>
+Game::Collision::SweepResult<T> Game::Collision::CCD_SweptAABB(const AABB<T>& moving, const Math::Vector2D<T>& displacement, const AABB<T>& target)
+{
+    SweepResult<T> result;
+    result.hit = false;
+    result.time = 1;
+
+    T entryX, exitX, entryY, exitY;
+    if (!SlabTest(moving.min.x, moving.max.x, target.min.x, target.max.x, displacement.x, entryX, exitX) ||
+        !SlabTest(moving.min.y, moving.max.y, target.min.y, target.max.y, displacement.y, entryY, exitY))
+    {
+        return result;
+    }
+
+    T entry = std::max(entryX, entryY);
+    T exit = std::min(exitX, exitY);
+    if (entry > exit || exit < 0 || entry > 1)
+    {
+        return result;
+    }
+
+    result.hit = true;
+    result.time = std::max(entry, T(0));
+    if (entryX > entryY)
+    {
+        result.normal = Vector2D<T>(displacement.x > 0 ? -1 : 1, 0);
+    }
+    else
+    {
+        result.normal = Vector2D<T>(0, displacement.y > 0 ? -1 : 1);
+    }
+    return result;
+}
+
+template <typename T>
+Game::Collision::TOI_Result<T> Game::Collision::CCD_TimeOfImpact(const Shape<T>& a, const Math::Vector2D<T>& velocityA, const Shape<T>& b, const Math::Vector2D<T>& velocityB, const T duration)
+{
+    const T tolerance = static_cast<T>(TOI_TOLERANCE);
+    const Vector2D<T> relativeVelocity = velocityA - velocityB;
+
+    TOI_Result<T> result;
+    result.hit = false;
+    result.time = duration;
+    result.iterations = 0;
+
+    Shape<T> movedA = a;
+    Shape<T> movedB = b;
+    GJK_Simplex<T> simplex;
+    T time = 0;
+
+    while (result.iterations < TOI_MAX_ITERATIONS)
+    {
+        result.iterations++;
+        movedA.position = a.position + velocityA * time;
+        movedB.position = b.position + velocityB * time;
+
+        GJK_Result<T> distance = GJK_Distance(movedA, movedB, simplex);
+        if (distance.intersecting)
+        {
+            // Only reachable at time 0, advancement never steps past the surface
+            EPA_Result<T> penetration = EPA_Penetration(movedA, movedB, simplex);
+            result.hit = true;
+            result.time = time;
+            result.normal = penetration.normal;
+            result.point = (penetration.pointA + penetration.pointB) * 0.5;
+            return result;
+        }
+
+        Vector2D<T> separation = distance.pointB - distance.pointA;
+        Vector2D<T> normal = separation * (1.0 / std::max<double>(distance.distance, std::numeric_limits<T>::min()));
+        if (distance.distance <= tolerance)
+        {
+            result.hit = true;
+            result.time = time;
+            result.normal = normal;
+            result.point = (distance.pointA + distance.pointB) * 0.5;
+            return result;
+        }
+
+        // Distance shrinks at most at the closing speed along the normal, so this step cannot overshoot
+        T closingSpeed = static_cast<T>(relativeVelocity.DotProduct(normal));
+        if (closingSpeed <= std::numeric_limits<T>::epsilon())
+        {
+            return result;
+        }
+
+        time += (distance.distance - tolerance / 2) / closingSpeed;
+        if (time > duration)
+        {
+            return result;
+        }
+    }
+
+    return result;
+}
+
+template Game::Collision::SweepResult<float> Game::Collision::CCD_SweptAABB(const AABB<float>&, const Game::Math::Vector2D<float>&, const AABB<float>&);
+template Game::Collision::SweepResult<double> Game::Collision::CCD_SweptAABB(const AABB<double>&, const Game::Math::Vector2D<double>&, const AABB<double>&);
+template Game::Collision::TOI_Result<float> Game::Collision::CCD_TimeOfImpact(const Shape<float>&, const Game::Math::Vector2D<float>&, const Shape<float>&, const Game::Math::Vector2D<float>&, const float);
+template Game::Collision::TOI_Result<double> Game::Collision::CCD_TimeOfImpact(const Shape<double>&, const Game::Math::Vector2D<double>&, const Shape<double>&, const Game::Math::Vector2D<double>&, const double);
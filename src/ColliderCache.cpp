@@ -0,0 +1,617 @@
+/**
+ *  \file ColliderCache.cpp
+ *
+ *  \brief Source file for ColliderBaker and ColliderCache.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/ColliderCache.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include "SDL2/SDL_image.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using Game::Collision::ColliderCacheVertex;
+using Game::Collision::ColliderCachePath;
+
+constexpr uint64_t COLLIDER_FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t COLLIDER_FNV_PRIME = 1099511628211ull;
+
+static uint64_t HashBytes(uint64_t hash, const unsigned char* bytes, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        hash ^= bytes[i];
+        hash *= COLLIDER_FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint64_t HashPath(const char* p_path, size_t length)
+{
+    return HashBytes(COLLIDER_FNV_OFFSET_BASIS, reinterpret_cast<const unsigned char*>(p_path), length);
+}
+
+static uint64_t HashRGBA32(SDL_Surface* rgba)
+{
+    uint64_t hash = COLLIDER_FNV_OFFSET_BASIS;
+    uint32_t size[2] = { static_cast<uint32_t>(rgba->w), static_cast<uint32_t>(rgba->h) };
+    hash = HashBytes(hash, reinterpret_cast<const unsigned char*>(size), sizeof(size));
+
+    const unsigned char* pixels = static_cast<const unsigned char*>(rgba->pixels);
+    for (int y = 0; y < rgba->h; y++)
+    {
+        hash = HashBytes(hash, pixels + static_cast<size_t>(y) * rgba->pitch, static_cast<size_t>(rgba->w) * 4);
+    }
+
+    // 0 is reserved for "no hash"
+    return hash == 0 ? 1 : hash;
+}
+
+static int64_t Cross(const ColliderCacheVertex& o, const ColliderCacheVertex& a, const ColliderCacheVertex& b)
+{
+    return static_cast<int64_t>(a.x - o.x) * (b.y - o.y) - static_cast<int64_t>(a.y - o.y) * (b.x - o.x);
+}
+
+// Andrew's monotone chain, counter clockwise, collinear points dropped
+static Game::Math::DynamicArray<ColliderCacheVertex> BuildHull(Game::Math::DynamicArray<ColliderCacheVertex>& points)
+{
+    std::sort(points.begin(), points.end(), [](const ColliderCacheVertex& a, const ColliderCacheVertex& b)
+    {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    });
+
+    Game::Math::DynamicArray<ColliderCacheVertex> hull(points.size() * 2);
+    size_t k = 0;
+
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        while (k >= 2 && Cross(hull[k - 2], hull[k - 1], points[i]) <= 0)
+        {
+            k--;
+        }
+        hull[k++] = points[i];
+    }
+
+    for (size_t i = points.size() - 1, lower = k + 1; i > 0; i--)
+    {
+        while (k >= lower && Cross(hull[k - 2], hull[k - 1], points[i - 1]) <= 0)
+        {
+            k--;
+        }
+        hull[k++] = points[i - 1];
+    }
+
+    hull.resize(k > 1 ? k - 1 : k);
+    return hull;
+}
+
+uint64_t Game::Collision::ColliderCache_HashSurface(SDL_Surface* surface)
+{
+    if (surface == nullptr)
+    {
+        return 0;
+    }
+
+    SDL_Surface* rgba = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    if (rgba == nullptr)
+    {
+        return 0;
+    }
+
+    SDL_LockSurface(rgba);
+    uint64_t hash = HashRGBA32(rgba);
+    SDL_UnlockSurface(rgba);
+    SDL_FreeSurface(rgba);
+    return hash;
+}
+
+Game::Collision::ColliderBaker :: ColliderBaker() : alphaThreshold(COLLIDER_DEFAULT_ALPHA_THRESHOLD)
+{
+
+}
+
+Game::Collision::ColliderBaker :: ColliderBaker(uint8_t p_alphaThreshold) : alphaThreshold(p_alphaThreshold)
+{
+
+}
+
+bool Game::Collision::ColliderBaker :: AddSurface(SDL_Surface* surface, const char* p_name)
+{
+    if (surface == nullptr || surface->w <= 0 || surface->h <= 0 || surface->w > INT16_MAX || surface->h > INT16_MAX)
+    {
+        std::cerr << "Collider baker: invalid surface" << std::endl;
+        return false;
+    }
+
+    SDL_Surface* rgba = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    if (rgba == nullptr)
+    {
+        std::cerr << "Collider baker: failed to convert surface: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    SDL_LockSurface(rgba);
+
+    uint64_t hash = HashRGBA32(rgba);
+    if (p_name != nullptr)
+    {
+        auto named = std::find_if(paths.begin(), paths.end(), [p_name](const Math::Pair<Math::String, uint64_t>& path)
+        {
+            return path.first == p_name;
+        });
+        if (named != paths.end())
+        {
+            named->second = hash;
+        }
+        else
+        {
+            paths.push_back({ p_name, hash });
+        }
+    }
+
+    for (const BakedCollider& collider : colliders)
+    {
+        if (collider.entry.imageHash == hash)
+        {
+            // Identical image already baked, the entry is shared
+            SDL_UnlockSurface(rgba);
+            SDL_FreeSurface(rgba);
+            return true;
+        }
+    }
+
+    BakedCollider baked;
+    std::memset(&baked.entry, 0, sizeof(baked.entry));
+    baked.entry.imageHash = hash;
+    baked.entry.width = static_cast<uint32_t>(rgba->w);
+    baked.entry.height = static_cast<uint32_t>(rgba->h);
+    baked.entry.maskWordsPerRow = static_cast<uint32_t>((rgba->w + 31) / 32);
+    baked.mask.assign(static_cast<size_t>(baked.entry.maskWordsPerRow) * rgba->h, 0);
+
+    int minX = rgba->w, minY = rgba->h, maxX = -1, maxY = -1;
+    Math::DynamicArray<ColliderCacheVertex> extents;
+
+    const unsigned char* pixels = static_cast<const unsigned char*>(rgba->pixels);
+    for (int y = 0; y < rgba->h; y++)
+    {
+        const unsigned char* row = pixels + static_cast<size_t>(y) * rgba->pitch;
+        uint32_t* maskRow = baked.mask.data() + static_cast<size_t>(y) * baked.entry.maskWordsPerRow;
+        int left = -1, right = -1;
+
+        for (int x = 0; x < rgba->w; x++)
+        {
+            // RGBA32 is byte ordered, alpha is always the fourth byte
+            if (row[x * 4 + 3] > alphaThreshold)
+            {
+                maskRow[x >> 5] |= 1u << (x & 31);
+                if (left < 0)
+                {
+                    left = x;
+                }
+                right = x;
+            }
+        }
+
+        if (left >= 0)
+        {
+            minX = std::min(minX, left);
+            maxX = std::max(maxX, right);
+            minY = std::min(minY, y);
+            maxY = y;
+
+            // Pixel corners of the row span, the hull of these covers every solid pixel
+            extents.push_back({ static_cast<int16_t>(left), static_cast<int16_t>(y) });
+            extents.push_back({ static_cast<int16_t>(left), static_cast<int16_t>(y + 1) });
+            extents.push_back({ static_cast<int16_t>(right + 1), static_cast<int16_t>(y) });
+            extents.push_back({ static_cast<int16_t>(right + 1), static_cast<int16_t>(y + 1) });
+        }
+    }
+
+    SDL_UnlockSurface(rgba);
+    SDL_FreeSurface(rgba);
+
+    if (maxX >= 0)
+    {
+        baked.entry.boundsX = minX;
+        baked.entry.boundsY = minY;
+        baked.entry.boundsW = maxX - minX + 1;
+        baked.entry.boundsH = maxY - minY + 1;
+        baked.vertices = BuildHull(extents);
+    }
+
+    baked.entry.vertexCount = static_cast<uint32_t>(baked.vertices.size());
+    colliders.push_back(std::move(baked));
+    return true;
+}
+
+bool Game::Collision::ColliderBaker :: AddImage(const char* p_path)
+{
+    SDL_Surface* surface = IMG_Load(p_path);
+    if (surface == nullptr)
+    {
+        std::cerr << "Collider baker: failed to load " << p_path << ": " << IMG_GetError() << std::endl;
+        return false;
+    }
+
+    bool added = AddSurface(surface, p_path);
+    SDL_FreeSurface(surface);
+    return added;
+}
+
+bool Game::Collision::ColliderBaker :: WriteToFile(const char* p_path) const
+{
+    Math::DynamicArray<const BakedCollider*> sorted;
+    sorted.reserve(colliders.size());
+    for (const BakedCollider& collider : colliders)
+    {
+        sorted.push_back(&collider);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const BakedCollider* a, const BakedCollider* b)
+    {
+        return a->entry.imageHash < b->entry.imageHash;
+    });
+
+    ColliderCacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = COLLIDER_CACHE_MAGIC;
+    header.version = COLLIDER_CACHE_VERSION;
+    header.entryCount = static_cast<uint32_t>(sorted.size());
+
+    Math::DynamicArray<ColliderCacheEntry> entries;
+    entries.reserve(sorted.size());
+    for (const BakedCollider* collider : sorted)
+    {
+        ColliderCacheEntry entry = collider->entry;
+        entry.firstVertex = header.vertexCount;
+        entry.firstMaskWord = header.maskWordCount;
+        header.vertexCount += static_cast<uint32_t>(collider->vertices.size());
+        header.maskWordCount += static_cast<uint32_t>(collider->mask.size());
+        entries.push_back(entry);
+    }
+
+    header.entryTableOffset = sizeof(ColliderCacheHeader);
+    header.vertexPoolOffset = header.entryTableOffset + sizeof(ColliderCacheEntry) * entries.size();
+    header.maskPoolOffset = header.vertexPoolOffset + sizeof(ColliderCacheVertex) * header.vertexCount;
+
+    Math::DynamicArray<ColliderCachePath> pathTable;
+    Math::String stringPool;
+    pathTable.reserve(paths.size());
+    for (const Math::Pair<Math::String, uint64_t>& path : paths)
+    {
+        ColliderCachePath entry;
+        entry.pathHash = HashPath(path.first.data(), path.first.size());
+        entry.imageHash = path.second;
+        entry.nameOffset = static_cast<uint32_t>(stringPool.size());
+        entry.nameLength = static_cast<uint32_t>(path.first.size());
+        stringPool += path.first;
+        pathTable.push_back(entry);
+    }
+    std::sort(pathTable.begin(), pathTable.end(), [](const ColliderCachePath& a, const ColliderCachePath& b)
+    {
+        return a.pathHash < b.pathHash;
+    });
+
+    uint64_t maskPoolEnd = header.maskPoolOffset + sizeof(uint32_t) * header.maskWordCount;
+    header.pathCount = static_cast<uint32_t>(pathTable.size());
+    header.pathTableOffset = (maskPoolEnd + alignof(ColliderCachePath) - 1) & ~static_cast<uint64_t>(alignof(ColliderCachePath) - 1);
+    header.stringPoolOffset = header.pathTableOffset + sizeof(ColliderCachePath) * pathTable.size();
+    header.fileSize = header.stringPoolOffset + stringPool.size();
+
+    std::FILE* file = std::fopen(p_path, "wb");
+    if (file == nullptr)
+    {
+        std::cerr << "Collider baker: failed to open " << p_path << " for writing" << std::endl;
+        return false;
+    }
+
+    bool written = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    if (written && !entries.empty())
+    {
+        written = std::fwrite(entries.data(), sizeof(ColliderCacheEntry), entries.size(), file) == entries.size();
+    }
+    for (const BakedCollider* collider : sorted)
+    {
+        if (written && !collider->vertices.empty())
+        {
+            written = std::fwrite(collider->vertices.data(), sizeof(ColliderCacheVertex), collider->vertices.size(), file) == collider->vertices.size();
+        }
+    }
+    for (const BakedCollider* collider : sorted)
+    {
+        if (written && !collider->mask.empty())
+        {
+            written = std::fwrite(collider->mask.data(), sizeof(uint32_t), collider->mask.size(), file) == collider->mask.size();
+        }
+    }
+
+
+    static const unsigned char padding[alignof(ColliderCachePath)] = {};
+    size_t paddingSize = static_cast<size_t>(header.pathTableOffset - maskPoolEnd);
+    if (written && paddingSize > 0)
+    {
+        written = std::fwrite(padding, 1, paddingSize, file) == paddingSize;
+    }
+    if (written && !pathTable.empty())
+    {
+        written = std::fwrite(pathTable.data(), sizeof(ColliderCachePath), pathTable.size(), file) == pathTable.size();
+    }
+    if (written && !stringPool.empty())
+    {
+        written = std::fwrite(stringPool.data(), 1, stringPool.size(), file) == stringPool.size();
+    }
+
+    if (std::fclose(file) != 0 || !written)
+    {
+        std::cerr << "Collider baker: failed to write " << p_path << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void Game::Collision::ColliderBaker :: Clear()
+{
+    colliders.clear();
+    paths.clear();
+}
+
+size_t Game::Collision::ColliderBaker :: GetEntryCount() const
+{
+    return colliders.size();
+}
+
+size_t Game::Collision::ColliderBaker :: GetPathCount() const
+{
+    return paths.size();
+}
+
+uint8_t Game::Collision::ColliderBaker :: GetAlphaThreshold() const
+{
+    return alphaThreshold;
+}
+
+Game::Collision::ColliderCache :: ColliderCache() : data(nullptr), size(0), header(nullptr), entries(nullptr), vertices(nullptr), mask(nullptr),
+    paths(nullptr), strings(nullptr),
+#ifdef _WIN32
+    fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr)
+#else
+    fileDescriptor(-1)
+#endif
+{
+
+}
+
+Game::Collision::ColliderCache :: ColliderCache(const char* p_path) : ColliderCache()
+{
+    Open(p_path);
+}
+
+Game::Collision::ColliderCache :: ~ColliderCache()
+{
+    Close();
+}
+
+bool Game::Collision::ColliderCache :: Open(const char* p_path)
+{
+    Close();
+
+#ifdef _WIN32
+    fileHandle = CreateFileA(p_path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        std::cerr << "Collider cache: failed to open " << p_path << std::endl;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0)
+    {
+        size = static_cast<size_t>(fileSize.QuadPart);
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle != nullptr)
+        {
+            data = static_cast<const unsigned char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        }
+    }
+#else
+    fileDescriptor = open(p_path, O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        std::cerr << "Collider cache: failed to open " << p_path << std::endl;
+        return false;
+    }
+
+    struct stat fileInfo;
+    if (fstat(fileDescriptor, &fileInfo) == 0 && fileInfo.st_size > 0)
+    {
+        size = static_cast<size_t>(fileInfo.st_size);
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        data = mapping == MAP_FAILED ? nullptr : static_cast<const unsigned char*>(mapping);
+    }
+#endif
+
+    if (data == nullptr || size < sizeof(ColliderCacheHeader))
+    {
+        std::cerr << "Collider cache: failed to map " << p_path << std::endl;
+        Close();
+        return false;
+    }
+
+    // Only the header is validated, the tables are used in place
+    header = reinterpret_cast<const ColliderCacheHeader*>(data);
+    if (header->magic != COLLIDER_CACHE_MAGIC || header->version != COLLIDER_CACHE_VERSION || header->fileSize != size ||
+        header->entryTableOffset + sizeof(ColliderCacheEntry) * static_cast<uint64_t>(header->entryCount) > header->vertexPoolOffset ||
+        header->vertexPoolOffset + sizeof(ColliderCacheVertex) * static_cast<uint64_t>(header->vertexCount) > header->maskPoolOffset ||
+        header->maskPoolOffset + sizeof(uint32_t) * static_cast<uint64_t>(header->maskWordCount) > header->pathTableOffset ||
+        header->pathTableOffset + sizeof(ColliderCachePath) * static_cast<uint64_t>(header->pathCount) > header->stringPoolOffset ||
+        header->stringPoolOffset > size ||
+        header->entryTableOffset % alignof(ColliderCacheEntry) != 0 || header->vertexPoolOffset % alignof(ColliderCacheVertex) != 0 ||
+        header->maskPoolOffset % alignof(uint32_t) != 0 || header->pathTableOffset % alignof(ColliderCachePath) != 0)
+    {
+        std::cerr << "Collider cache: " << p_path << " is not a valid version " << COLLIDER_CACHE_VERSION << " cache" << std::endl;
+        Close();
+        return false;
+    }
+
+    entries = reinterpret_cast<const ColliderCacheEntry*>(data + header->entryTableOffset);
+    vertices = reinterpret_cast<const ColliderCacheVertex*>(data + header->vertexPoolOffset);
+    mask = reinterpret_cast<const uint32_t*>(data + header->maskPoolOffset);
+    paths = reinterpret_cast<const ColliderCachePath*>(data + header->pathTableOffset);
+    strings = reinterpret_cast<const char*>(data + header->stringPoolOffset);
+    return true;
+}
+
+void Game::Collision::ColliderCache :: Close()
+{
+#ifdef _WIN32
+    if (data != nullptr)
+    {
+        UnmapViewOfFile(data);
+    }
+    if (mappingHandle != nullptr)
+    {
+        CloseHandle(mappingHandle);
+    }
+    if (fileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(fileHandle);
+    }
+    mappingHandle = nullptr;
+    fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if (data != nullptr)
+    {
+        munmap(const_cast<unsigned char*>(data), size);
+    }
+    if (fileDescriptor >= 0)
+    {
+        close(fileDescriptor);
+    }
+    fileDescriptor = -1;
+#endif
+
+    data = nullptr;
+    size = 0;
+    header = nullptr;
+    entries = nullptr;
+    vertices = nullptr;
+    mask = nullptr;
+    paths = nullptr;
+    strings = nullptr;
+}
+
+const Game::Collision::ColliderCacheEntry* Game::Collision::ColliderCache :: Find(uint64_t imageHash) const
+{
+    if (header == nullptr)
+    {
+        return nullptr;
+    }
+
+    const ColliderCacheEntry* end = entries + header->entryCount;
+    const ColliderCacheEntry* found = std::lower_bound(entries, end, imageHash, [](const ColliderCacheEntry& entry, uint64_t hash)
+    {
+        return entry.imageHash < hash;
+    });
+
+    if (found == end || found->imageHash != imageHash)
+    {
+        return nullptr;
+    }
+    return found;
+}
+
+const Game::Collision::ColliderCacheEntry* Game::Collision::ColliderCache :: Find(const char* p_path) const
+{
+    if (header == nullptr || p_path == nullptr)
+    {
+        return nullptr;
+    }
+
+    size_t length = std::strlen(p_path);
+    uint64_t pathHash = HashPath(p_path, length);
+    const ColliderCachePath* end = paths + header->pathCount;
+    const ColliderCachePath* found = std::lower_bound(paths, end, pathHash, [](const ColliderCachePath& path, uint64_t hash)
+    {
+        return path.pathHash < hash;
+    });
+
+    // Equal hashes are adjacent, the name decides
+    uint64_t stringPoolSize = size - header->stringPoolOffset;
+    for (; found != end && found->pathHash == pathHash; found++)
+    {
+        if (found->nameLength == length && static_cast<uint64_t>(found->nameOffset) + found->nameLength <= stringPoolSize &&
+            std::memcmp(strings + found->nameOffset, p_path, length) == 0)
+        {
+            return Find(found->imageHash);
+        }
+    }
+    return nullptr;
+}
+
+const Game::Collision::ColliderCacheEntry* Game::Collision::ColliderCache :: Find(SDL_Surface* surface) const
+{
+    return Find(ColliderCache_HashSurface(surface));
+}
+
+const Game::Collision::ColliderCacheVertex* Game::Collision::ColliderCache :: GetVertices(const ColliderCacheEntry& entry) const
+{
+    if (header == nullptr || static_cast<uint64_t>(entry.firstVertex) + entry.vertexCount > header->vertexCount)
+    {
+        return nullptr;
+    }
+    return vertices + entry.firstVertex;
+}
+
+const uint32_t* Game::Collision::ColliderCache :: GetMask(const ColliderCacheEntry& entry) const
+{
+    if (header == nullptr || static_cast<uint64_t>(entry.firstMaskWord) + static_cast<uint64_t>(entry.maskWordsPerRow) * entry.height > header->maskWordCount)
+    {
+        return nullptr;
+    }
+    return mask + entry.firstMaskWord;
+}
+
+bool Game::Collision::ColliderCache :: IsSolid(const ColliderCacheEntry& entry, int x, int y) const
+{
+    if (x < 0 || y < 0 || static_cast<uint32_t>(x) >= entry.width || static_cast<uint32_t>(y) >= entry.height)
+    {
+        return false;
+    }
+
+    const uint32_t* rows = GetMask(entry);
+    if (rows == nullptr)
+    {
+        return false;
+    }
+    return (rows[static_cast<size_t>(y) * entry.maskWordsPerRow + (x >> 5)] >> (x & 31)) & 1u;
+}
+
+bool Game::Collision::ColliderCache :: IsOpen() const
+{
+    return header != nullptr;
+}
+
+uint32_t Game::Collision::ColliderCache :: GetEntryCount() const
+{
+    return header == nullptr ? 0 : header->entryCount;
+}
+
+uint32_t Game::Collision::ColliderCache :: GetPathCount() const
+{
+    return header == nullptr ? 0 : header->pathCount;
+}
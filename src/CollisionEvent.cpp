@@ -0,0 +1,95 @@
+/**
+ *  \file CollisionEvent.cpp
+ *
+ *  \brief Source file for CollisionEvent.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/CollisionEvent.hpp"
+
+#include <algorithm>
+
+static Game::Collision::CollisionEvent MakeEvent(uint64_t key, Game::Collision::CollisionEventType type, bool isTrigger)
+{
+    return { static_cast<uint32_t>(key >> 32), static_cast<uint32_t>(key), type, isTrigger };
+}
+
+Game::Collision::CollisionEventStream :: CollisionEventStream()
+{
+
+}
+
+void Game::Collision::CollisionEventStream :: BeginFrame()
+{
+    current.clear();
+}
+
+void Game::Collision::CollisionEventStream :: AddTouching(uint32_t idA, uint32_t idB, bool isTrigger)
+{
+    if (idA > idB)
+    {
+        std::swap(idA, idB);
+    }
+    current.push_back({ (static_cast<uint64_t>(idA) << 32) | idB, isTrigger });
+}
+
+void Game::Collision::CollisionEventStream :: EndFrame()
+{
+    auto byKey = [](const TouchingPair& a, const TouchingPair& b)
+    {
+        return a.key < b.key;
+    };
+    if (!std::is_sorted(current.begin(), current.end(), byKey))
+    {
+        std::sort(current.begin(), current.end(), byKey);
+    }
+
+    // Merge walk over both sorted sets
+    events.clear();
+    size_t i = 0, j = 0;
+    while (i < previous.size() || j < current.size())
+    {
+        if (j == current.size() || (i < previous.size() && previous[i].key < current[j].key))
+        {
+            events.push_back(MakeEvent(previous[i].key, CollisionEventType::Exit, previous[i].isTrigger));
+            i++;
+        }
+        else if (i == previous.size() || current[j].key < previous[i].key)
+        {
+            events.push_back(MakeEvent(current[j].key, CollisionEventType::Enter, current[j].isTrigger));
+            j++;
+        }
+        else
+        {
+            events.push_back(MakeEvent(current[j].key, CollisionEventType::Stay, current[j].isTrigger));
+            i++;
+            j++;
+        }
+    }
+
+    previous.swap(current);
+}
+
+void Game::Collision::CollisionEventStream :: Clear()
+{
+    previous.clear();
+    current.clear();
+    events.clear();
+}
+
+const Game::Math::DynamicArray<Game::Collision::CollisionEvent>& Game::Collision::CollisionEventStream :: GetEvents() const
+{
+    return events;
+}
+
+size_t Game::Collision::CollisionEventStream :: GetTouchingCount() const
+{
+    return previous.size();
+}
+
+Game::Collision::CollisionEvent Game::Collision::CollisionEventStream :: GetTouching(size_t index) const
+{
+    return MakeEvent(previous[index].key, CollisionEventType::Stay, previous[index].isTrigger);
+}
@@ -0,0 +1,576 @@
+/**
+ *  \file CollisionWorld.cpp
+ *
+ *  \brief Source file for CollisionWorld.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/CollisionWorld.hpp"
+
+#include <algorithm>
+
+template <typename T>
+Game::Collision::CollisionWorld<T> :: CollisionWorld() : nextId(1), staticDirty(false)
+{
+
+}
+
+template <typename T>
+Game::Collision::CollisionWorld<T> :: CollisionWorld(size_t workerCount) : nextId(1), staticDirty(false), pool(workerCount)
+{
+
+}
+
+template <typename T>
+uint32_t Game::Collision::CollisionWorld<T> :: AddCollider(const Shape<T>& shape, void* userData)
+{
+    Collider<T> collider;
+    collider.id = nextId++;
+    collider.shape = shape;
+    collider.bounds = shape.ComputeAABB();
+    collider.isFast = false;
+    collider.isResting = false;
+    collider.isStatic = false;
+    collider.isTrigger = false;
+    collider.filter = CollisionFilter_Default();
+    collider.userData = userData;
+
+    indices[collider.id] = colliders.size();
+    colliders.push_back(collider);
+    broadphase.Reset();
+    return collider.id;
+}
+
+template <typename T>
+uint32_t Game::Collision::CollisionWorld<T> :: AddStaticCollider(const Shape<T>& shape, void* userData)
+{
+    uint32_t id = AddCollider(shape, userData);
+    Collider<T>& collider = colliders.back();
+    collider.isResting = true;
+    collider.isStatic = true;
+    staticDirty = true;
+    return id;
+}
+
+template <typename T>
+bool Game::Collision::CollisionWorld<T> :: RemoveCollider(uint32_t id)
+{
+    auto found = indices.find(id);
+    if (found == indices.end())
+    {
+        return false;
+    }
+
+    // Swap with the last collider to keep the array dense
+    size_t index = found->second;
+    indices.erase(found);
+    staticDirty = staticDirty || colliders[index].isStatic;
+    if (index + 1 != colliders.size())
+    {
+        colliders[index] = colliders.back();
+        indices[colliders[index].id] = index;
+    }
+    colliders.pop_back();
+    broadphase.Reset();
+    return true;
+}
+
+template <typename T>
+Game::Collision::Collider<T>* Game::Collision::CollisionWorld<T> :: GetCollider(uint32_t id)
+{
+    auto found = indices.find(id);
+    return found == indices.end() ? nullptr : &colliders[found->second];
+}
+
+template <typename T>
+const Game::Collision::Collider<T>* Game::Collision::CollisionWorld<T> :: GetCollider(uint32_t id) const
+{
+    auto found = indices.find(id);
+    return found == indices.end() ? nullptr : &colliders[found->second];
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: SetTransform(uint32_t id, const Math::Vector2D<T>& position, const T rotation)
+{
+    Collider<T>* collider = GetCollider(id);
+    if (collider == nullptr)
+    {
+        return;
+    }
+
+    collider->shape.SetPosition(position);
+    if (collider->shape.rotation != rotation)
+    {
+        collider->shape.SetRotation(rotation);
+    }
+    staticDirty = staticDirty || collider->isStatic;
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: SetVelocity(uint32_t id, const Math::Vector2D<T>& velocity)
+{
+    Collider<T>* collider = GetCollider(id);
+    if (collider != nullptr)
+    {
+        collider->velocity = velocity;
+    }
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: SetFast(uint32_t id, bool fast)
+{
+    Collider<T>* collider = GetCollider(id);
+    if (collider != nullptr)
+    {
+        collider->isFast = fast;
+    }
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: SetResting(uint32_t id, bool resting)
+{
+    Collider<T>* collider = GetCollider(id);
+    if (collider != nullptr)
+    {
+        collider->isResting = resting;
+    }
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: SetFilter(uint32_t id, const CollisionFilter& filter)
+{
+    Collider<T>* collider = GetCollider(id);
+    if (collider != nullptr)
+    {
+        collider->filter = filter;
+    }
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: SetTrigger(uint32_t id, bool trigger)
+{
+    Collider<T>* collider = GetCollider(id);
+    if (collider != nullptr)
+    {
+        collider->isTrigger = trigger;
+    }
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: Update()
+{
+    Update(0);
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: Update(const T timeStep)
+{
+    if (staticDirty)
+    {
+        RebuildStaticTree();
+    }
+
+    for (Collider<T>& collider : colliders)
+    {
+        if (collider.isStatic)
+        {
+            continue;
+        }
+
+        collider.bounds = collider.shape.ComputeAABB();
+        if (collider.isFast && timeStep > 0)
+        {
+            Math::Vector2D<T> displacement = collider.velocity * timeStep;
+            collider.bounds = collider.bounds.Merge(AABB<T>(collider.bounds.min + displacement, collider.bounds.max + displacement));
+        }
+    }
+
+    contactCache.BeginFrame();
+    broadphase.FindPairs(colliders.data(), colliders.size(), candidatePairs);
+    FindStaticPairs();
+    narrowphase.Dispatch(colliders.data(), candidatePairs.data(), candidatePairs.size(), contactCache, pool, contacts);
+    contactCache.EndFrame();
+
+    // Contacts come out in (idA, idB) order, which is the order the stream wants
+    events.BeginFrame();
+    for (const NarrowphaseResult<T>& contact : contacts)
+    {
+        events.AddTouching(contact.idA, contact.idB, contact.isTrigger);
+    }
+    CarryRestingPairs();
+    events.EndFrame();
+    contacts.erase(std::remove_if(contacts.begin(), contacts.end(), [](const NarrowphaseResult<T>& contact)
+    {
+        return contact.isTrigger;
+    }), contacts.end());
+
+    impacts.clear();
+    if (timeStep <= 0)
+    {
+        return;
+    }
+
+    for (const CandidatePair& pair : candidatePairs)
+    {
+        const Collider<T>* fast = &colliders[pair.a];
+        const Collider<T>* other = &colliders[pair.b];
+        if (!fast->isFast)
+        {
+            std::swap(fast, other);
+            if (!fast->isFast)
+            {
+                continue;
+            }
+        }
+
+        // Cheap reject on the relative sweep of the unswept boxes before the GJK iterations
+        Math::Vector2D<T> otherVelocity = other->isFast ? other->velocity : Math::Vector2D<T>();
+        Math::Vector2D<T> displacement = (fast->velocity - otherVelocity) * timeStep;
+        if (!CCD_SweptAABB(fast->shape.ComputeAABB(), displacement, other->shape.ComputeAABB()).hit)
+        {
+            continue;
+        }
+
+        TOI_Result<T> impact = CCD_TimeOfImpact(fast->shape, fast->velocity, other->shape, otherVelocity, timeStep);
+        if (impact.hit)
+        {
+            impacts.push_back({ fast->id, other->id, impact.time, impact.normal, impact.point });
+        }
+    }
+
+    std::stable_sort(impacts.begin(), impacts.end(), [](const TimeOfImpactEvent<T>& a, const TimeOfImpactEvent<T>& b)
+    {
+        return a.time < b.time;
+    });
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: RebuildStaticTree()
+{
+    staticItems.clear();
+    for (Collider<T>& collider : colliders)
+    {
+        if (collider.isStatic)
+        {
+            collider.bounds = collider.shape.ComputeAABB();
+            staticItems.push_back({ collider.bounds, collider.id });
+        }
+    }
+
+    staticTree.Build(staticItems.data(), staticItems.size());
+    staticDirty = false;
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: FindStaticPairs()
+{
+    if (staticTree.GetItemCount() == 0)
+    {
+        return;
+    }
+
+    staticPairs.clear();
+    for (size_t i = 0; i < colliders.size(); i++)
+    {
+        const Collider<T>& collider = colliders[i];
+        if (collider.isResting || collider.isStatic)
+        {
+            continue;
+        }
+
+        staticTree.QueryRegion(collider.bounds, staticHits);
+        for (uint32_t id : staticHits)
+        {
+            uint32_t other = static_cast<uint32_t>(indices[id]);
+            if (!CollisionFilter_ShouldCollide(collider.filter, colliders[other].filter))
+            {
+                continue;
+            }
+
+            if (collider.id < id)
+            {
+                staticPairs.push_back({ static_cast<uint32_t>(i), other });
+            }
+            else
+            {
+                staticPairs.push_back({ other, static_cast<uint32_t>(i) });
+            }
+        }
+    }
+
+    // Same (lower id, higher id) order as the sweep, merged in place
+    auto byIds = [this](const CandidatePair& p, const CandidatePair& q)
+    {
+        return colliders[p.a].id < colliders[q.a].id || (colliders[p.a].id == colliders[q.a].id && colliders[p.b].id < colliders[q.b].id);
+    };
+    std::sort(staticPairs.begin(), staticPairs.end(), byIds);
+
+    size_t middle = candidatePairs.size();
+    candidatePairs.insert(candidatePairs.end(), staticPairs.begin(), staticPairs.end());
+    std::inplace_merge(candidatePairs.begin(), candidatePairs.begin() + middle, candidatePairs.end(), byIds);
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: CarryRestingPairs()
+{
+    // Pairs skipped by both broadphase paths would otherwise read as an exit now and an enter on wake up
+    for (size_t i = 0; i < events.GetTouchingCount(); i++)
+    {
+        CollisionEvent pair = events.GetTouching(i);
+        const Collider<T>* first = GetCollider(pair.idA);
+        const Collider<T>* second = GetCollider(pair.idB);
+        if (first == nullptr || second == nullptr)
+        {
+            continue;
+        }
+        if (!(first->isResting || first->isStatic) || !(second->isResting || second->isStatic))
+        {
+            continue;
+        }
+        if (!CollisionFilter_ShouldCollide(first->filter, second->filter))
+        {
+            continue;
+        }
+
+        events.AddTouching(pair.idA, pair.idB, pair.isTrigger);
+    }
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: QueryCandidates(const AABB<T>& region, Math::DynamicArray<uint32_t>& candidates, Math::DynamicArray<uint32_t>& scratch) const
+{
+    broadphase.QueryRegion(colliders.data(), colliders.size(), region, candidates);
+    staticTree.QueryRegion(region, scratch);
+    for (uint32_t id : scratch)
+    {
+        // The tree only catches up with removed static colliders on the next Update()
+        auto found = indices.find(id);
+        if (found != indices.end())
+        {
+            candidates.push_back(static_cast<uint32_t>(found->second));
+        }
+    }
+}
+
+template <typename T>
+Game::Collision::RaycastHit<T> Game::Collision::CollisionWorld<T> :: CastRay(const RaycastInput<T>& ray, Math::DynamicArray<uint32_t>& candidates,
+    Math::DynamicArray<uint32_t>& scratch, Math::DynamicArray<RaycastHit<T>>* allHits) const
+{
+    const AABB<T> start(ray.origin, ray.origin);
+    const AABB<T> region = start.Merge(AABB<T>(ray.origin + ray.translation, ray.origin + ray.translation));
+
+    // Dynamic colliders by the ray's bounds and a slab test, static ones by walking the tree along the ray
+    broadphase.QueryRegion(colliders.data(), colliders.size(), region, scratch);
+    candidates.clear();
+    for (uint32_t index : scratch)
+    {
+        if (CCD_SweptAABB(start, ray.translation, colliders[index].bounds).hit)
+        {
+            candidates.push_back(index);
+        }
+    }
+    staticTree.QueryRay(ray.origin, ray.translation, scratch);
+    for (uint32_t id : scratch)
+    {
+        auto found = indices.find(id);
+        if (found != indices.end())
+        {
+            candidates.push_back(static_cast<uint32_t>(found->second));
+        }
+    }
+
+    RaycastHit<T> closest;
+    closest.hit = false;
+    closest.id = 0;
+    closest.fraction = 1;
+    for (uint32_t index : candidates)
+    {
+        const Collider<T>& collider = colliders[index];
+        if (!CollisionFilter_ShouldCollide(ray.filter, collider.filter))
+        {
+            continue;
+        }
+
+        RaycastHit<T> hit = Raycast_Shape(collider.shape, ray.origin, ray.translation);
+        if (!hit.hit)
+        {
+            continue;
+        }
+        hit.id = collider.id;
+
+        if (allHits != nullptr)
+        {
+            allHits->push_back(hit);
+        }
+        if (!closest.hit || hit.fraction < closest.fraction || (hit.fraction == closest.fraction && hit.id < closest.id))
+        {
+            closest = hit;
+        }
+    }
+    return closest;
+}
+
+template <typename T>
+Game::Collision::RaycastHit<T> Game::Collision::CollisionWorld<T> :: RayCast(const Math::Vector2D<T>& origin, const Math::Vector2D<T>& translation, const CollisionFilter& filter) const
+{
+    Math::DynamicArray<uint32_t> candidates, scratch;
+    return CastRay({ origin, translation, filter }, candidates, scratch, nullptr);
+}
+
+template <typename T>
+size_t Game::Collision::CollisionWorld<T> :: RayCastAll(const Math::Vector2D<T>& origin, const Math::Vector2D<T>& translation, Math::DynamicArray<RaycastHit<T>>& hits,
+    const CollisionFilter& filter) const
+{
+    Math::DynamicArray<uint32_t> candidates, scratch;
+    hits.clear();
+    CastRay({ origin, translation, filter }, candidates, scratch, &hits);
+
+    std::sort(hits.begin(), hits.end(), [](const RaycastHit<T>& a, const RaycastHit<T>& b)
+    {
+        return a.fraction < b.fraction || (a.fraction == b.fraction && a.id < b.id);
+    });
+    return hits.size();
+}
+
+template <typename T>
+void Game::Collision::CollisionWorld<T> :: RayCastBatch(const RaycastInput<T>* rays, size_t count, RaycastHit<T>* hits)
+{
+    // Rays go out in chunks, each pool slot keeps its own candidate arrays
+    queryScratch.resize(2 * pool.GetSlotCount());
+    size_t chunkCount = (count + RAYCAST_BATCH_SIZE - 1) / RAYCAST_BATCH_SIZE;
+    pool.ParallelFor(chunkCount, [this, rays, count, hits](size_t chunk, size_t worker)
+    {
+        Math::DynamicArray<uint32_t>& candidates = queryScratch[2 * worker];
+        Math::DynamicArray<uint32_t>& scratch = queryScratch[2 * worker + 1];
+        size_t end = std::min(count, (chunk + 1) * RAYCAST_BATCH_SIZE);
+        for (size_t i = chunk * RAYCAST_BATCH_SIZE; i < end; i++)
+        {
+            hits[i] = CastRay(rays[i], candidates, scratch, nullptr);
+        }
+    });
+}
+
+template <typename T>
+Game::Collision::RaycastHit<T> Game::Collision::CollisionWorld<T> :: ShapeCast(const Shape<T>& shape, const Math::Vector2D<T>& translation, const CollisionFilter& filter) const
+{
+    AABB<T> bounds = shape.ComputeAABB();
+    AABB<T> region = bounds.Merge(AABB<T>(bounds.min + translation, bounds.max + translation));
+    Math::DynamicArray<uint32_t> candidates, scratch;
+    QueryCandidates(region, candidates, scratch);
+
+    RaycastHit<T> closest;
+    closest.hit = false;
+    closest.id = 0;
+    closest.fraction = 1;
+    const Math::Vector2D<T> still;
+    for (uint32_t index : candidates)
+    {
+        const Collider<T>& collider = colliders[index];
+        if (!CollisionFilter_ShouldCollide(filter, collider.filter))
+        {
+            continue;
+        }
+
+        // Over a duration of 1 the time of impact is the fraction of the translation
+        TOI_Result<T> impact = CCD_TimeOfImpact(shape, translation, collider.shape, still, T(1));
+        if (!impact.hit)
+        {
+            continue;
+        }
+        if (!closest.hit || impact.time < closest.fraction || (impact.time == closest.fraction && collider.id < closest.id))
+        {
+            closest.hit = true;
+            closest.id = collider.id;
+            closest.fraction = impact.time;
+            closest.point = impact.point;
+            closest.normal = impact.normal * -1.0;
+        }
+    }
+    return closest;
+}
+
+template <typename T>
+size_t Game::Collision::CollisionWorld<T> :: QueryOverlap(const Shape<T>& shape, Math::DynamicArray<uint32_t>& ids, const CollisionFilter& filter) const
+{
+    Math::DynamicArray<uint32_t> candidates, scratch;
+    QueryCandidates(shape.ComputeAABB(), candidates, scratch);
+
+    ids.clear();
+    for (uint32_t index : candidates)
+    {
+        const Collider<T>& collider = colliders[index];
+        GJK_Simplex<T> simplex;
+        if (CollisionFilter_ShouldCollide(filter, collider.filter) && GJK_Intersect(shape, collider.shape, simplex))
+        {
+            ids.push_back(collider.id);
+        }
+    }
+
+    std::sort(ids.begin(), ids.end());
+    return ids.size();
+}
+
+template <typename T>
+const Game::Math::DynamicArray<Game::Collision::CandidatePair>& Game::Collision::CollisionWorld<T> :: GetCandidatePairs() const
+{
+    return candidatePairs;
+}
+
+template <typename T>
+const Game::Math::DynamicArray<Game::Collision::NarrowphaseResult<T>>& Game::Collision::CollisionWorld<T> :: GetContacts() const
+{
+    return contacts;
+}
+
+template <typename T>
+const Game::Math::DynamicArray<Game::Collision::TimeOfImpactEvent<T>>& Game::Collision::CollisionWorld<T> :: GetTimeOfImpacts() const
+{
+    return impacts;
+}
+
+template <typename T>
+const Game::Math::DynamicArray<Game::Collision::CollisionEvent>& Game::Collision::CollisionWorld<T> :: GetEvents() const
+{
+    return events.GetEvents();
+}
+
+template <typename T>
+const Game::Collision::Collider<T>* Game::Collision::CollisionWorld<T> :: GetColliders() const
+{
+    return colliders.data();
+}
+
+template <typename T>
+size_t Game::Collision::CollisionWorld<T> :: GetColliderCount() const
+{
+    return colliders.size();
+}
+
+template <typename T>
+const Game::Collision::Quadtree<T>& Game::Collision::CollisionWorld<T> :: GetStaticTree() const
+{
+    return staticTree;
+}
+
+template <typename T>
+Game::Collision::ContactCache<T>& Game::Collision::CollisionWorld<T> :: GetContactCache()
+{
+    return contactCache;
+}
+
+template <typename T>
+Game::Collision::Narrowphase<T>& Game::Collision::CollisionWorld<T> :: GetNarrowphase()
+{
+    return narrowphase;
+}
+
+template <typename T>
+Game::Utils::ThreadPool& Game::Collision::CollisionWorld<T> :: GetThreadPool()
+{
+    return pool;
+}
+
+template class Game::Collision::CollisionWorld<float>;
+template class Game::Collision::CollisionWorld<double>;
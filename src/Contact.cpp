@@ -0,0 +1,422 @@
+/**
+ *  \file Contact.cpp
+ *
+ *  \brief Source file for Contact.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/Contact.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using Game::Math::Vector2D;
+using Game::Collision::Shape;
+using Game::Collision::ShapeType;
+using Game::Collision::ContactManifold;
+
+// Capsules only present a flat side when their axis is this close to perpendicular to the normal
+constexpr double CONTACT_CAPSULE_EDGE_THRESHOLD = 0.05;
+constexpr double CONTACT_LINEAR_SLOP = 1e-4;
+constexpr double CONTACT_REFERENCE_TOLERANCE = 5e-3;
+
+template <typename T>
+struct Feature
+{
+    bool isEdge;
+    Vector2D<T> start, end;         // Counter clockwise, outward normal is (e.y, -e.x)
+    uint32_t index;
+};
+
+template <typename T>
+static Vector2D<T> SafeNormalize(const Vector2D<T>& v)
+{
+    double length = v.Magnitude();
+    if (length <= 0)
+    {
+        return Vector2D<T>();
+    }
+    return Vector2D<T>(static_cast<T>(v.x / length), static_cast<T>(v.y / length));
+}
+
+template <typename T>
+static Feature<T> FindFeature(const Shape<T>& shape, const Vector2D<T>& direction)
+{
+    Feature<T> feature;
+    feature.isEdge = false;
+    feature.index = 0;
+
+    size_t count = shape.GetVertexCount();
+    if (shape.type == ShapeType::Capsule)
+    {
+        Vector2D<T> start = shape.GetVertex(0);
+        Vector2D<T> end = shape.GetVertex(1);
+        Vector2D<T> axis = SafeNormalize(end - start);
+        if (std::abs(axis.DotProduct(direction)) > CONTACT_CAPSULE_EDGE_THRESHOLD)
+        {
+            return feature;
+        }
+
+        Vector2D<T> offset = direction * shape.radius;
+        feature.isEdge = true;
+        feature.start = start + offset;
+        feature.end = end + offset;
+        if (Vector2D<T>(axis.y, -axis.x).DotProduct(direction) < 0)
+        {
+            std::swap(feature.start, feature.end);
+            feature.index = 1;
+        }
+        return feature;
+    }
+
+    if (count < 3)
+    {
+        return feature;
+    }
+
+    size_t best = 0;
+    double bestProjection = shape.GetVertex(0).DotProduct(direction);
+    for (size_t i = 1; i < count; i++)
+    {
+        double projection = shape.GetVertex(i).DotProduct(direction);
+        if (projection > bestProjection)
+        {
+            bestProjection = projection;
+            best = i;
+        }
+    }
+
+    size_t previous = (best + count - 1) % count;
+    size_t next = (best + 1) % count;
+    Vector2D<T> vertex = shape.GetVertex(best);
+    Vector2D<T> previousVertex = shape.GetVertex(previous);
+    Vector2D<T> nextVertex = shape.GetVertex(next);
+
+    // Of the two edges meeting at the support vertex, take the one facing the direction
+    double left = std::abs(SafeNormalize(vertex - previousVertex).DotProduct(direction));
+    double right = std::abs(SafeNormalize(nextVertex - vertex).DotProduct(direction));
+
+    feature.isEdge = true;
+    if (right <= left)
+    {
+        feature.start = vertex;
+        feature.end = nextVertex;
+        feature.index = static_cast<uint32_t>(best);
+    }
+    else
+    {
+        feature.start = previousVertex;
+        feature.end = vertex;
+        feature.index = static_cast<uint32_t>(previous);
+    }
+    return feature;
+}
+
+// Keeps the part of the segment where dot(normal, p) >= offset
+template <typename T>
+static int ClipSegment(const Vector2D<T> input[2], Vector2D<T> output[2], const Vector2D<T>& normal, const double offset)
+{
+    int count = 0;
+    double distance0 = normal.DotProduct(input[0]) - offset;
+    double distance1 = normal.DotProduct(input[1]) - offset;
+
+    if (distance0 >= 0)
+    {
+        output[count++] = input[0];
+    }
+    if (distance1 >= 0)
+    {
+        output[count++] = input[1];
+    }
+    if (distance0 * distance1 < 0)
+    {
+        double t = distance0 / (distance0 - distance1);
+        output[count++] = input[0] + (input[1] - input[0]) * t;
+    }
+    return count;
+}
+
+template <typename T>
+static void SinglePointManifold(const Game::Collision::EPA_Result<T>& penetration, ContactManifold<T>& manifold)
+{
+    manifold.pointCount = 1;
+    manifold.points[0].position = (penetration.pointA + penetration.pointB) * 0.5;
+    manifold.points[0].depth = penetration.depth;
+    manifold.points[0].featureId = 0;
+    manifold.points[0].normalImpulse = 0;
+    manifold.points[0].tangentImpulse = 0;
+}
+
+// Expects an overlapping pair and the simplex GJK ended with
+template <typename T>
+static bool BuildManifold(const Shape<T>& a, const Shape<T>& b, const Game::Collision::GJK_Simplex<T>& simplex, ContactManifold<T>& manifold)
+{
+    manifold.pointCount = 0;
+
+    Game::Collision::EPA_Result<T> penetration = Game::Collision::EPA_Penetration(a, b, simplex);
+    if (!penetration.valid)
+    {
+        return false;
+    }
+
+    const Vector2D<T>& normal = penetration.normal;
+    manifold.normal = normal;
+
+    Feature<T> featureA = FindFeature(a, normal);
+    Feature<T> featureB = FindFeature(b, Vector2D<T>(-normal.x, -normal.y));
+    if (!featureA.isEdge || !featureB.isEdge)
+    {
+        SinglePointManifold(penetration, manifold);
+        return true;
+    }
+
+    // The reference edge is the one most perpendicular to the normal, the other one is clipped against it.
+    // A prefers its own edge on near ties so resting stacks keep their feature ids between frames.
+    Vector2D<T> edgeA = SafeNormalize(featureA.end - featureA.start);
+    Vector2D<T> edgeB = SafeNormalize(featureB.end - featureB.start);
+    bool referenceIsB = std::abs(edgeB.DotProduct(normal)) + CONTACT_REFERENCE_TOLERANCE < std::abs(edgeA.DotProduct(normal));
+
+    const Feature<T>& reference = referenceIsB ? featureB : featureA;
+    const Feature<T>& incident = referenceIsB ? featureA : featureB;
+    Vector2D<T> tangent = referenceIsB ? edgeB : edgeA;
+    Vector2D<T> referenceNormal(tangent.y, -tangent.x);
+
+    Vector2D<T> incidentPoints[2] = { incident.start, incident.end };
+    Vector2D<T> clipped[2];
+    Vector2D<T> clippedTwice[2];
+
+    if (ClipSegment(incidentPoints, clipped, tangent, tangent.DotProduct(reference.start)) < 2 ||
+        ClipSegment(clipped, clippedTwice, Vector2D<T>(-tangent.x, -tangent.y), -tangent.DotProduct(reference.end)) < 2)
+    {
+        SinglePointManifold(penetration, manifold);
+        return true;
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        double separation = referenceNormal.DotProduct(clippedTwice[i] - reference.start);
+        if (separation > CONTACT_LINEAR_SLOP)
+        {
+            continue;
+        }
+
+        Game::Collision::ContactPoint<T>& point = manifold.points[manifold.pointCount++];
+        point.depth = static_cast<T>(std::max(-separation, 0.0));
+        point.position = clippedTwice[i] + referenceNormal * (point.depth * 0.5);
+        point.featureId = static_cast<uint64_t>(reference.index) | (static_cast<uint64_t>(incident.index) << 31) |
+                          (static_cast<uint64_t>(i) << 62) | (static_cast<uint64_t>(referenceIsB) << 63);
+        point.normalImpulse = 0;
+        point.tangentImpulse = 0;
+    }
+
+    if (manifold.pointCount == 0)
+    {
+        SinglePointManifold(penetration, manifold);
+    }
+    return true;
+}
+
+template <typename T>
+bool Game::Collision::Contact_Generate(const Shape<T>& a, const Shape<T>& b, GJK_Simplex<T>& simplex, ContactManifold<T>& manifold)
+{
+    manifold.pointCount = 0;
+    if (!GJK_Intersect(a, b, simplex))
+    {
+        return false;
+    }
+    return BuildManifold(a, b, simplex, manifold);
+}
+
+uint64_t Game::Collision::ContactCache_PairKey(uint32_t idA, uint32_t idB)
+{
+    if (idA > idB)
+    {
+        std::swap(idA, idB);
+    }
+    return (static_cast<uint64_t>(idA) << 32) | idB;
+}
+
+template <typename T>
+Game::Collision::ContactCache<T> :: ContactCache() : frame(0), stats()
+{
+
+}
+
+template <typename T>
+void Game::Collision::ContactCache<T> :: BeginFrame()
+{
+    frame++;
+}
+
+template <typename T>
+void Game::Collision::ContactCache<T> :: EndFrame()
+{
+    for (auto it = pairs.begin(); it != pairs.end();)
+    {
+        if (it->second.lastFrame != frame)
+        {
+            it = pairs.erase(it);
+            stats.evictions++;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+template <typename T>
+void Game::Collision::ContactCache<T> :: Clear()
+{
+    pairs.clear();
+}
+
+template <typename T>
+bool Game::Collision::ContactCache<T> :: Collide(uint32_t idA, const Shape<T>& a, uint32_t idB, const Shape<T>& b)
+{
+    ContactPair<T>& pair = Acquire(idA, idB);
+    ContactOutcome outcome = idA < idB ? Update(pair, a, b) : Update(pair, b, a);
+    Record(outcome);
+    return outcome == ContactOutcome::Touching;
+}
+
+template <typename T>
+Game::Collision::ContactPair<T>& Game::Collision::ContactCache<T> :: Acquire(uint32_t idA, uint32_t idB)
+{
+    // Pairs are always stored lower id first so the normal has a fixed orientation
+    if (idA > idB)
+    {
+        std::swap(idA, idB);
+    }
+
+    auto inserted = pairs.try_emplace(ContactCache_PairKey(idA, idB));
+    ContactPair<T>& pair = inserted.first->second;
+    if (inserted.second)
+    {
+        pair.idA = idA;
+        pair.idB = idB;
+        pair.hasSeparatingAxis = false;
+    }
+    pair.lastFrame = frame;
+    return pair;
+}
+
+template <typename T>
+Game::Collision::ContactOutcome Game::Collision::ContactCache<T> :: Update(ContactPair<T>& pair, const Shape<T>& a, const Shape<T>& b)
+{
+    // Still separated along last frame's axis, nothing else to do
+    if (pair.hasSeparatingAxis)
+    {
+        Vector2D<T> opposite(-pair.separatingAxis.x, -pair.separatingAxis.y);
+        double maxA = a.Support(pair.separatingAxis).DotProduct(pair.separatingAxis);
+        double minB = b.Support(opposite).DotProduct(pair.separatingAxis);
+        if (maxA < minB)
+        {
+            pair.manifold.pointCount = 0;
+            return ContactOutcome::SeparatedByCachedAxis;
+        }
+    }
+
+    // The distance query leaves the closest points, which give next frame's separating axis for free
+    ContactManifold<T> previous = pair.manifold;
+    GJK_Result<T> separation = GJK_Distance(a, b, pair.simplex);
+    if (!separation.intersecting)
+    {
+        pair.manifold.pointCount = 0;
+        pair.separatingAxis = SafeNormalize(separation.pointB - separation.pointA);
+        pair.hasSeparatingAxis = separation.distance > 0;
+        return ContactOutcome::Separated;
+    }
+
+    pair.hasSeparatingAxis = false;
+    if (!BuildManifold(a, b, pair.simplex, pair.manifold))
+    {
+        return ContactOutcome::Separated;
+    }
+
+    // Carry accumulated impulses over to contacts that survived from last frame
+    for (int i = 0; i < pair.manifold.pointCount; i++)
+    {
+        ContactPoint<T>& point = pair.manifold.points[i];
+        for (int j = 0; j < previous.pointCount; j++)
+        {
+            if (previous.points[j].featureId == point.featureId)
+            {
+                point.normalImpulse = previous.points[j].normalImpulse;
+                point.tangentImpulse = previous.points[j].tangentImpulse;
+                break;
+            }
+        }
+    }
+    return ContactOutcome::Touching;
+}
+
+template <typename T>
+void Game::Collision::ContactCache<T> :: Record(ContactOutcome outcome)
+{
+    stats.queries++;
+    if (outcome == ContactOutcome::SeparatedByCachedAxis)
+    {
+        stats.separatingAxisEarlyOuts++;
+    }
+    else
+    {
+        stats.narrowphaseRuns++;
+    }
+}
+
+template <typename T>
+void Game::Collision::ContactCache<T> :: Record(const ContactCacheStats& partial)
+{
+    stats.queries += partial.queries;
+    stats.separatingAxisEarlyOuts += partial.separatingAxisEarlyOuts;
+    stats.narrowphaseRuns += partial.narrowphaseRuns;
+    stats.evictions += partial.evictions;
+}
+
+template <typename T>
+Game::Collision::ContactPair<T>* Game::Collision::ContactCache<T> :: Find(uint32_t idA, uint32_t idB)
+{
+    auto found = pairs.find(ContactCache_PairKey(idA, idB));
+    return found == pairs.end() ? nullptr : &found->second;
+}
+
+template <typename T>
+const Game::Collision::ContactPair<T>* Game::Collision::ContactCache<T> :: Find(uint32_t idA, uint32_t idB) const
+{
+    auto found = pairs.find(ContactCache_PairKey(idA, idB));
+    return found == pairs.end() ? nullptr : &found->second;
+}
+
+template <typename T>
+size_t Game::Collision::ContactCache<T> :: GetPairCount() const
+{
+    return pairs.size();
+}
+
+template <typename T>
+uint64_t Game::Collision::ContactCache<T> :: GetFrame() const
+{
+    return frame;
+}
+
+template <typename T>
+const Game::Collision::ContactCacheStats& Game::Collision::ContactCache<T> :: GetStats() const
+{
+    return stats;
+}
+
+template <typename T>
+void Game::Collision::ContactCache<T> :: ResetStats()
+{
+    stats = ContactCacheStats();
+}
+
+template bool Game::Collision::Contact_Generate(const Shape<float>&, const Shape<float>&, GJK_Simplex<float>&, ContactManifold<float>&);
+template bool Game::Collision::Contact_Generate(const Shape<double>&, const Shape<double>&, GJK_Simplex<double>&, ContactManifold<double>&);
+
+template class Game::Collision::ContactCache<float>;
+template class Game::Collision::ContactCache<double>;
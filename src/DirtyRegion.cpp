@@ -0,0 +1,250 @@
+/**
+ *  \file DirtyRegion.cpp
+ *
+ *  \brief Source file for DirtyRegion.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Graphics/DirtyRegion.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+static int64_t Area(const SDL_Rect& rect)
+{
+    return static_cast<int64_t>(rect.w) * rect.h;
+}
+
+Game::Graphics::DirtyRegionTracker :: DirtyRegionTracker(int p_width, int p_height) : width(p_width), height(p_height),
+    fullRedrawRatio(DIRTY_FULL_REDRAW_RATIO), isFullRedraw(true)
+{
+    rects.reserve(DIRTY_MAX_RECTS + 1);
+}
+
+void Game::Graphics::DirtyRegionTracker :: MarkDirty(const SDL_Rect& rect)
+{
+    SDL_Rect screen = { 0, 0, width, height };
+    SDL_Rect dirty;
+    if (isFullRedraw || !SDL_IntersectRect(&rect, &screen, &dirty))
+    {
+        return;
+    }
+
+    // Keep merging while the grown rect swallows neighbours cheaply
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (size_t i = 0; i < rects.size(); i++)
+        {
+            SDL_Rect combined, overlap;
+            SDL_UnionRect(&rects[i], &dirty, &combined);
+            int64_t shared = SDL_IntersectRect(&rects[i], &dirty, &overlap) ? Area(overlap) : 0;
+            if (Area(combined) - (Area(rects[i]) + Area(dirty) - shared) <= DIRTY_MERGE_SLACK)
+            {
+                dirty = combined;
+                rects[i] = rects.back();
+                rects.pop_back();
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    rects.push_back(dirty);
+    CheckThreshold();
+}
+
+void Game::Graphics::DirtyRegionTracker :: MarkAll()
+{
+    rects.clear();
+    isFullRedraw = true;
+}
+
+void Game::Graphics::DirtyRegionTracker :: Clear()
+{
+    rects.clear();
+    isFullRedraw = false;
+}
+
+void Game::Graphics::DirtyRegionTracker :: Resize(int p_width, int p_height)
+{
+    width = p_width;
+    height = p_height;
+    MarkAll();
+}
+
+bool Game::Graphics::DirtyRegionTracker :: IsClean() const
+{
+    return !isFullRedraw && rects.empty();
+}
+
+bool Game::Graphics::DirtyRegionTracker :: IsFullRedraw() const
+{
+    return isFullRedraw;
+}
+
+const Game::Math::DynamicArray<SDL_Rect>& Game::Graphics::DirtyRegionTracker :: GetRects() const
+{
+    return rects;
+}
+
+int64_t Game::Graphics::DirtyRegionTracker :: GetDirtyArea() const
+{
+    if (isFullRedraw)
+    {
+        return static_cast<int64_t>(width) * height;
+    }
+
+    // Merged rects may still overlap a little, the sum is an upper bound
+    int64_t area = 0;
+    for (const SDL_Rect& rect : rects)
+    {
+        area += Area(rect);
+    }
+    return area;
+}
+
+void Game::Graphics::DirtyRegionTracker :: SetFullRedrawRatio(double ratio)
+{
+    fullRedrawRatio = std::min(std::max(ratio, 0.0), 1.0);
+}
+
+double Game::Graphics::DirtyRegionTracker :: GetFullRedrawRatio() const
+{
+    return fullRedrawRatio;
+}
+
+void Game::Graphics::DirtyRegionTracker :: CheckThreshold()
+{
+    if (rects.size() > DIRTY_MAX_RECTS || GetDirtyArea() > fullRedrawRatio * width * height)
+    {
+        MarkAll();
+    }
+}
+
+Game::Graphics::DirtyRenderTarget :: DirtyRenderTarget(SDL_Renderer* p_renderer, int p_w, int p_h) : renderer(p_renderer), target(nullptr), tracker(p_w, p_h), stats()
+{
+    Resize(p_w, p_h);
+}
+
+Game::Graphics::DirtyRenderTarget :: ~DirtyRenderTarget()
+{
+    if (target != nullptr)
+    {
+        SDL_DestroyTexture(target);
+    }
+}
+
+bool Game::Graphics::DirtyRenderTarget :: Render(const DrawCallback& draw)
+{
+    if (target == nullptr)
+    {
+        return false;
+    }
+
+    bool isRedrawn = !tracker.IsClean();
+    if (isRedrawn)
+    {
+        SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+        SDL_SetRenderTarget(renderer, target);
+        if (tracker.IsFullRedraw())
+        {
+            int w = 0, h = 0;
+            SDL_QueryTexture(target, nullptr, nullptr, &w, &h);
+            Redraw(draw, SDL_Rect{ 0, 0, w, h });
+            stats.fullFrames++;
+        }
+        else
+        {
+            for (const SDL_Rect& rect : tracker.GetRects())
+            {
+                Redraw(draw, rect);
+            }
+            stats.partialFrames++;
+        }
+        SDL_RenderSetClipRect(renderer, nullptr);
+        SDL_SetRenderTarget(renderer, previousTarget);
+        tracker.Clear();
+    }
+    else
+    {
+        stats.cleanFrames++;
+    }
+
+    SDL_RenderCopy(renderer, target, nullptr, nullptr);
+    return isRedrawn;
+}
+
+bool Game::Graphics::DirtyRenderTarget :: Resize(int w, int h)
+{
+    if (target != nullptr)
+    {
+        SDL_DestroyTexture(target);
+    }
+
+    target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, w, h);
+    tracker.Resize(w, h);
+    if (target == nullptr)
+    {
+        std::cerr << "DirtyRenderTarget: Can't create a " << w << "x" << h << " target: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool Game::Graphics::DirtyRenderTarget :: HandleEvent(const SDL_Event& event)
+{
+    if (event.type == SDL_RENDER_TARGETS_RESET)
+    {
+        tracker.MarkAll();
+        return true;
+    }
+    if (event.type == SDL_RENDER_DEVICE_RESET)
+    {
+        // The texture lost its storage with the device, Resize() recreates it and marks everything dirty
+        int w = 0, h = 0;
+        SDL_QueryTexture(target, nullptr, nullptr, &w, &h);
+        return Resize(w, h);
+    }
+    return false;
+}
+
+Game::Graphics::DirtyRegionTracker& Game::Graphics::DirtyRenderTarget :: GetTracker()
+{
+    return tracker;
+}
+
+SDL_Texture* Game::Graphics::DirtyRenderTarget :: GetTexture() const
+{
+    return target;
+}
+
+const Game::Graphics::DirtyRenderStats& Game::Graphics::DirtyRenderTarget :: GetStats() const
+{
+    return stats;
+}
+
+void Game::Graphics::DirtyRenderTarget :: ResetStats()
+{
+    stats = DirtyRenderStats();
+}
+
+void Game::Graphics::DirtyRenderTarget :: Redraw(const DrawCallback& draw, const SDL_Rect& clip)
+{
+    // The old pixels under the clip are stale, the callback paints from the background up
+    SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+    Uint8 r = 0, g = 0, b = 0, a = 0;
+    SDL_GetRenderDrawBlendMode(renderer, &blendMode);
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+    SDL_RenderSetClipRect(renderer, &clip);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderFillRect(renderer, &clip);
+    SDL_SetRenderDrawBlendMode(renderer, blendMode);
+    SDL_SetRenderDrawColor(renderer, r, g, b, a);
+    draw(renderer, clip);
+    stats.pixelsRedrawn += static_cast<uint64_t>(clip.w) * clip.h;
+}
@@ -1,17 +1,17 @@
 #ifndef FONT_CPP_
 #define FONT_CPP_
 
-#include "Font.hpp"
+#include "Entity/Font.hpp"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_ttf.h>
 
-Game::Entity::Font :: Font()
+Game::Entity::Font :: Font() : font(nullptr), horizontalAlignment(false), verticalAlignment(false)
 {
 	
 }
 
-Game::Entity::Font :: Font(const char* p_path, int size, bool HAlign, bool VAlign)
+Game::Entity::Font :: Font(const char* p_path, int size, bool HAlign, bool VAlign) : font(nullptr)
 {
 	if (TTF_Init() < 0)
 	{
@@ -30,6 +30,7 @@ Game::Entity::Font :: Font(const char* p_path, int size, bool HAlign, bool VAlig
 
 Game::Entity::Font :: ~Font()
 {
+	glyphAtlases.clear();
 	if (font != nullptr)
 	{
 		TTF_CloseFont(font);
@@ -39,6 +40,7 @@ Game::Entity::Font :: ~Font()
 
 void Game::Entity::Font :: OpenFont(const char* p_path, int size, bool HAlign, bool VAlign)
 {
+	Unload();
 	if (TTF_Init() < 0)
 	{
 		std::cout  << "Can't initialize SDL_ttf. Error: " << SDL_GetError() << '\n';
@@ -56,6 +58,7 @@ void Game::Entity::Font :: OpenFont(const char* p_path, int size, bool HAlign, b
 
 void Game::Entity::Font :: Unload()
 {
+	glyphAtlases.clear();
 	if (font != nullptr)
 	{
 		TTF_CloseFont(font);
@@ -89,6 +92,38 @@ SDL_Texture* Game::Entity::Font :: CreateTextTexture(SDL_Renderer* renderer, con
 	return texture;
 }
 
+void Game::Entity::Font :: DrawText(Graphics::SpriteBatch& batch, const char* p_text, float x, float y, SDL_Color color, int layer)
+{
+	Graphics::GlyphAtlas* atlas = GetGlyphAtlas(batch.GetRenderer());
+	if (atlas == nullptr)
+	{
+		std::cout << "Font not loaded.\n";
+		return;
+	}
+	atlas->DrawText(batch, p_text, x, y, color, layer);
+}
+
+Game::Graphics::GlyphAtlas* Game::Entity::Font :: GetGlyphAtlas(SDL_Renderer* renderer)
+{
+	if (font == nullptr)
+	{
+		return nullptr;
+	}
+	
+	// Atlases of other renderers stay alive, their pages may still be queued in a batch
+	std::unique_ptr<Graphics::GlyphAtlas>& atlas = glyphAtlases[renderer];
+	if (atlas == nullptr)
+	{
+		atlas.reset(new Graphics::GlyphAtlas(font, renderer));
+	}
+	return atlas.get();
+}
+
+void Game::Entity::Font :: ReleaseGlyphAtlas(SDL_Renderer* renderer)
+{
+	glyphAtlases.erase(renderer);
+}
+
 TTF_Font* Game::Entity::Font :: GetFont() const 
 {
     return font;
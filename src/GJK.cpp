@@ -0,0 +1,423 @@
+/**
+ *  \file GJK.cpp
+ *
+ *  \brief Source file for GJK.hpp.
+ *
+ *  The simplex solver follows the barycentric (signed area) formulation of
+ *  Johnson's algorithm, so the closest point never needs a division by a
+ *  vanishing edge length.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/GJK.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using Game::Math::Vector2D;
+using Game::Collision::Shape;
+using Game::Collision::GJK_Simplex;
+using Game::Collision::GJK_SimplexVertex;
+
+template <typename T>
+static T Tolerance(const double base)
+{
+    return std::max(static_cast<T>(base), std::numeric_limits<T>::epsilon() * 100);
+}
+
+template <typename T>
+static void MakeVertex(const Shape<T>& a, const Shape<T>& b, const Vector2D<T>& direction, GJK_SimplexVertex<T>& vertex)
+{
+    vertex.direction = direction;
+    vertex.pointA = a.Support(direction);
+    vertex.pointB = b.Support(Vector2D<T>(-direction.x, -direction.y));
+    vertex.point = vertex.pointA - vertex.pointB;
+    vertex.weight = 1;
+}
+
+template <typename T>
+static void Solve2(GJK_Simplex<T>& simplex)
+{
+    const Vector2D<T> w1 = simplex.vertices[0].point;
+    const Vector2D<T> w2 = simplex.vertices[1].point;
+    const Vector2D<T> e12 = w2 - w1;
+
+    // Region of w1
+    T d12_2 = -w1.DotProduct(e12);
+    if (d12_2 <= 0)
+    {
+        simplex.vertices[0].weight = 1;
+        simplex.count = 1;
+        return;
+    }
+
+    // Region of w2
+    T d12_1 = w2.DotProduct(e12);
+    if (d12_1 <= 0)
+    {
+        simplex.vertices[0] = simplex.vertices[1];
+        simplex.vertices[0].weight = 1;
+        simplex.count = 1;
+        return;
+    }
+
+    T inverse = 1 / (d12_1 + d12_2);
+    simplex.vertices[0].weight = d12_1 * inverse;
+    simplex.vertices[1].weight = d12_2 * inverse;
+    simplex.count = 2;
+}
+
+template <typename T>
+static void Solve3(GJK_Simplex<T>& simplex)
+{
+    const Vector2D<T> w1 = simplex.vertices[0].point;
+    const Vector2D<T> w2 = simplex.vertices[1].point;
+    const Vector2D<T> w3 = simplex.vertices[2].point;
+
+    const Vector2D<T> e12 = w2 - w1;
+    T d12_1 = w2.DotProduct(e12);
+    T d12_2 = -w1.DotProduct(e12);
+
+    const Vector2D<T> e13 = w3 - w1;
+    T d13_1 = w3.DotProduct(e13);
+    T d13_2 = -w1.DotProduct(e13);
+
+    const Vector2D<T> e23 = w3 - w2;
+    T d23_1 = w3.DotProduct(e23);
+    T d23_2 = -w2.DotProduct(e23);
+
+    T n123 = e12.CrossProduct(e13);
+    T d123_1 = n123 * w2.CrossProduct(w3);
+    T d123_2 = n123 * w3.CrossProduct(w1);
+    T d123_3 = n123 * w1.CrossProduct(w2);
+
+    // Vertex region w1
+    if (d12_2 <= 0 && d13_2 <= 0)
+    {
+        simplex.vertices[0].weight = 1;
+        simplex.count = 1;
+        return;
+    }
+
+    // Edge region e12
+    if (d12_1 > 0 && d12_2 > 0 && d123_3 <= 0)
+    {
+        T inverse = 1 / (d12_1 + d12_2);
+        simplex.vertices[0].weight = d12_1 * inverse;
+        simplex.vertices[1].weight = d12_2 * inverse;
+        simplex.count = 2;
+        return;
+    }
+
+    // Edge region e13
+    if (d13_1 > 0 && d13_2 > 0 && d123_2 <= 0)
+    {
+        T inverse = 1 / (d13_1 + d13_2);
+        simplex.vertices[0].weight = d13_1 * inverse;
+        simplex.vertices[2].weight = d13_2 * inverse;
+        simplex.vertices[1] = simplex.vertices[2];
+        simplex.count = 2;
+        return;
+    }
+
+    // Vertex region w2
+    if (d12_1 <= 0 && d23_2 <= 0)
+    {
+        simplex.vertices[0] = simplex.vertices[1];
+        simplex.vertices[0].weight = 1;
+        simplex.count = 1;
+        return;
+    }
+
+    // Vertex region w3
+    if (d13_1 <= 0 && d23_1 <= 0)
+    {
+        simplex.vertices[0] = simplex.vertices[2];
+        simplex.vertices[0].weight = 1;
+        simplex.count = 1;
+        return;
+    }
+
+    // Edge region e23
+    if (d23_1 > 0 && d23_2 > 0 && d123_1 <= 0)
+    {
+        T inverse = 1 / (d23_1 + d23_2);
+        simplex.vertices[1].weight = d23_1 * inverse;
+        simplex.vertices[2].weight = d23_2 * inverse;
+        simplex.vertices[0] = simplex.vertices[2];
+        simplex.count = 2;
+        return;
+    }
+
+    // Origin is inside the triangle
+    T inverse = 1 / (d123_1 + d123_2 + d123_3);
+    simplex.vertices[0].weight = d123_1 * inverse;
+    simplex.vertices[1].weight = d123_2 * inverse;
+    simplex.vertices[2].weight = d123_3 * inverse;
+    simplex.count = 3;
+}
+
+template <typename T>
+static Game::Collision::GJK_Result<T> Run(const Shape<T>& a, const Shape<T>& b, GJK_Simplex<T>& simplex, const bool earlyOut)
+{
+    const T tolerance = Tolerance<T>(Game::Collision::GJK_TOLERANCE);
+
+    // Warm start: re-evaluate last frame's search directions against the current poses
+    int rebuilt = 0;
+    for (int i = 0; i < simplex.count; i++)
+    {
+        MakeVertex(a, b, simplex.vertices[i].direction, simplex.vertices[rebuilt]);
+
+        bool duplicate = false;
+        for (int j = 0; j < rebuilt; j++)
+        {
+            Vector2D<T> delta = simplex.vertices[rebuilt].point - simplex.vertices[j].point;
+            duplicate = duplicate || delta.DotProduct(delta) <= tolerance * tolerance;
+        }
+        if (!duplicate)
+        {
+            rebuilt++;
+        }
+    }
+    simplex.count = rebuilt;
+
+    if (simplex.count == 0)
+    {
+        Vector2D<T> direction = a.GetCenter() - b.GetCenter();
+        if (direction.DotProduct(direction) <= tolerance * tolerance)
+        {
+            direction = Vector2D<T>(1, 0);
+        }
+        MakeVertex(a, b, direction, simplex.vertices[0]);
+        simplex.count = 1;
+    }
+
+    Game::Collision::GJK_Result<T> result;
+    result.intersecting = false;
+    result.iterations = 0;
+
+    Vector2D<T> closest;
+    while (result.iterations < Game::Collision::GJK_MAX_ITERATIONS)
+    {
+        result.iterations++;
+
+        switch (simplex.count)
+        {
+            case 1:
+                simplex.vertices[0].weight = 1;
+                break;
+            case 2:
+                Solve2(simplex);
+                break;
+            case 3:
+                Solve3(simplex);
+                break;
+        }
+
+        if (simplex.count == 3)
+        {
+            result.intersecting = true;
+            break;
+        }
+
+        closest = Vector2D<T>();
+        for (int i = 0; i < simplex.count; i++)
+        {
+            closest = closest + simplex.vertices[i].point * simplex.vertices[i].weight;
+        }
+
+        T distanceSquared = closest.DotProduct(closest);
+        if (distanceSquared <= tolerance * tolerance)
+        {
+            result.intersecting = true;
+            break;
+        }
+
+        Vector2D<T> direction(-closest.x, -closest.y);
+        GJK_SimplexVertex<T> vertex;
+        MakeVertex(a, b, direction, vertex);
+
+        // The new support point does not pass the origin, direction is a separating axis
+        if (earlyOut && vertex.point.DotProduct(direction) < 0)
+        {
+            break;
+        }
+
+        // No more progress towards the origin
+        if (distanceSquared - closest.DotProduct(vertex.point) <= tolerance * distanceSquared)
+        {
+            break;
+        }
+
+        bool duplicate = false;
+        for (int i = 0; i < simplex.count; i++)
+        {
+            Vector2D<T> delta = vertex.point - simplex.vertices[i].point;
+            duplicate = duplicate || delta.DotProduct(delta) <= tolerance * tolerance;
+        }
+        if (duplicate)
+        {
+            break;
+        }
+
+        simplex.vertices[simplex.count++] = vertex;
+    }
+
+    result.pointA = Vector2D<T>();
+    result.pointB = Vector2D<T>();
+    for (int i = 0; i < simplex.count; i++)
+    {
+        result.pointA = result.pointA + simplex.vertices[i].pointA * simplex.vertices[i].weight;
+        result.pointB = result.pointB + simplex.vertices[i].pointB * simplex.vertices[i].weight;
+    }
+
+    result.distance = result.intersecting ? 0 : static_cast<T>((result.pointA - result.pointB).Magnitude());
+    return result;
+}
+
+template <typename T>
+bool Game::Collision::GJK_Intersect(const Shape<T>& a, const Shape<T>& b, GJK_Simplex<T>& simplex)
+{
+    return Run(a, b, simplex, true).intersecting;
+}
+
+template <typename T>
+Game::Collision::GJK_Result<T> Game::Collision::GJK_Distance(const Shape<T>& a, const Shape<T>& b, GJK_Simplex<T>& simplex)
+{
+    return Run(a, b, simplex, false);
+}
+
+template <typename T>
+Game::Collision::EPA_Result<T> Game::Collision::EPA_Penetration(const Shape<T>& a, const Shape<T>& b, const GJK_Simplex<T>& simplex)
+{
+    constexpr int capacity = EPA_MAX_ITERATIONS + 3;
+    const T tolerance = Tolerance<T>(EPA_TOLERANCE);
+    const T degenerate = Tolerance<T>(GJK_TOLERANCE);
+
+    EPA_Result<T> result;
+    result.valid = false;
+    result.depth = 0;
+
+    GJK_SimplexVertex<T> polytope[capacity];
+    int count = simplex.count;
+    for (int i = 0; i < count; i++)
+    {
+        polytope[i] = simplex.vertices[i];
+    }
+
+    // GJK may stop on a point or segment when the shapes only touch, grow it into a triangle
+    if (count == 1)
+    {
+        const Vector2D<T> axes[4] = { Vector2D<T>(1, 0), Vector2D<T>(-1, 0), Vector2D<T>(0, 1), Vector2D<T>(0, -1) };
+        for (const Vector2D<T>& axis : axes)
+        {
+            MakeVertex(a, b, axis, polytope[1]);
+            Vector2D<T> delta = polytope[1].point - polytope[0].point;
+            if (delta.DotProduct(delta) > degenerate * degenerate)
+            {
+                count = 2;
+                break;
+            }
+        }
+    }
+
+    if (count == 2)
+    {
+        Vector2D<T> edge = polytope[1].point - polytope[0].point;
+        Vector2D<T> normals[2] = { edge.Perpendicular(), Vector2D<T>(edge.y, -edge.x) };
+        for (const Vector2D<T>& normal : normals)
+        {
+            MakeVertex(a, b, normal, polytope[2]);
+            if (std::abs(edge.CrossProduct(polytope[2].point - polytope[0].point)) > degenerate)
+            {
+                count = 3;
+                break;
+            }
+        }
+    }
+
+    if (count < 3)
+    {
+        return result;
+    }
+
+    // Counter clockwise winding, so (e.y, -e.x) is the outward normal of every edge
+    if ((polytope[1].point - polytope[0].point).CrossProduct(polytope[2].point - polytope[0].point) < 0)
+    {
+        std::swap(polytope[1], polytope[2]);
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        const Vector2D<T>& from = polytope[i].point;
+        const Vector2D<T>& to = polytope[(i + 1) % 3].point;
+        if ((to - from).CrossProduct(Vector2D<T>(-from.x, -from.y)) < -degenerate)
+        {
+            // Origin is outside, the shapes are separated
+            return result;
+        }
+    }
+
+    int closestEdge = 0;
+    Vector2D<T> normal;
+    T distance = 0;
+
+    for (int iteration = 0; iteration < EPA_MAX_ITERATIONS; iteration++)
+    {
+        distance = std::numeric_limits<T>::max();
+        for (int i = 0; i < count; i++)
+        {
+            Vector2D<T> edge = polytope[(i + 1) % count].point - polytope[i].point;
+            T length = static_cast<T>(edge.Magnitude());
+            if (length <= degenerate)
+            {
+                continue;
+            }
+
+            Vector2D<T> edgeNormal(edge.y / length, -edge.x / length);
+            T edgeDistance = static_cast<T>(edgeNormal.DotProduct(polytope[i].point));
+            if (edgeDistance < distance)
+            {
+                distance = edgeDistance;
+                normal = edgeNormal;
+                closestEdge = i;
+            }
+        }
+
+        GJK_SimplexVertex<T> vertex;
+        MakeVertex(a, b, normal, vertex);
+        if (vertex.point.DotProduct(normal) - distance <= tolerance || count == capacity)
+        {
+            break;
+        }
+
+        for (int i = count; i > closestEdge + 1; i--)
+        {
+            polytope[i] = polytope[i - 1];
+        }
+        polytope[closestEdge + 1] = vertex;
+        count++;
+    }
+
+    const GJK_SimplexVertex<T>& from = polytope[closestEdge];
+    const GJK_SimplexVertex<T>& to = polytope[(closestEdge + 1) % count];
+    Vector2D<T> edge = to.point - from.point;
+    T t = std::clamp(static_cast<T>(-from.point.DotProduct(edge) / edge.DotProduct(edge)), T(0), T(1));
+
+    result.valid = true;
+    result.normal = normal;
+    result.depth = std::max(distance, T(0));
+    result.pointA = from.pointA + (to.pointA - from.pointA) * t;
+    result.pointB = from.pointB + (to.pointB - from.pointB) * t;
+    return result;
+}
+
+template bool Game::Collision::GJK_Intersect(const Shape<float>&, const Shape<float>&, GJK_Simplex<float>&);
+template bool Game::Collision::GJK_Intersect(const Shape<double>&, const Shape<double>&, GJK_Simplex<double>&);
+template Game::Collision::GJK_Result<float> Game::Collision::GJK_Distance(const Shape<float>&, const Shape<float>&, GJK_Simplex<float>&);
+template Game::Collision::GJK_Result<double> Game::Collision::GJK_Distance(const Shape<double>&, const Shape<double>&, GJK_Simplex<double>&);
+template Game::Collision::EPA_Result<float> Game::Collision::EPA_Penetration(const Shape<float>&, const Shape<float>&, const GJK_Simplex<float>&);
+template Game::Collision::EPA_Result<double> Game::Collision::EPA_Penetration(const Shape<double>&, const Shape<double>&, const GJK_Simplex<double>&);
@@ -0,0 +1,240 @@
+/**
+ *  \file GameLoop.cpp
+ *
+ *  \brief Source file for GameLoop.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Graphics/GameLoop.hpp"
+
+#include <algorithm>
+
+Game::Graphics::GameLoop :: GameLoop(Window& p_window) : window(p_window), input(nullptr), tickRate(GAMELOOP_DEFAULT_TICK_RATE), targetFrameRate(0),
+    frequency(SDL_GetPerformanceFrequency()), previousCounter(0), nextFrameCounter(0), accumulator(0), running(false), started(false),
+    frameHistory(), historyCount(0), historyNext(0), stats()
+{
+
+}
+
+void Game::Graphics::GameLoop :: SetTickCallback(std::function<void(double)> callback)
+{
+    onTick = std::move(callback);
+}
+
+void Game::Graphics::GameLoop :: SetRenderCallback(std::function<void(double)> callback)
+{
+    onRender = std::move(callback);
+}
+
+void Game::Graphics::GameLoop :: SetEventCallback(std::function<void(const SDL_Event&)> callback)
+{
+    onEvent = std::move(callback);
+}
+
+void Game::Graphics::GameLoop :: SetInput(Input::InputSystem* p_input)
+{
+    input = p_input;
+}
+
+Game::Input::InputSystem* Game::Graphics::GameLoop :: GetInput() const
+{
+    return input;
+}
+
+void Game::Graphics::GameLoop :: SetTickRate(double ticksPerSecond)
+{
+    if (ticksPerSecond > 0)
+    {
+        tickRate = ticksPerSecond;
+    }
+}
+
+double Game::Graphics::GameLoop :: GetTickRate() const
+{
+    return tickRate;
+}
+
+void Game::Graphics::GameLoop :: SetTargetFrameRate(double framesPerSecond)
+{
+    targetFrameRate = std::max(framesPerSecond, 0.0);
+}
+
+double Game::Graphics::GameLoop :: GetTargetFrameRate() const
+{
+    if (targetFrameRate > 0)
+    {
+        return targetFrameRate;
+    }
+
+    int refreshRate = window.GetRefreshRate();
+    return refreshRate > 0 ? refreshRate : GAMELOOP_FALLBACK_FRAME_RATE;
+}
+
+void Game::Graphics::GameLoop :: Run()
+{
+    running = true;
+    while (RunFrame())
+    {
+
+    }
+}
+
+bool Game::Graphics::GameLoop :: RunFrame()
+{
+    bool isFirstFrame = !started;
+    if (isFirstFrame)
+    {
+        previousCounter = SDL_GetPerformanceCounter();
+        nextFrameCounter = previousCounter;
+        accumulator = 0;
+        running = true;
+        started = true;
+    }
+
+    PumpEvents();
+    window.Update();
+    if (!running)
+    {
+        started = false;
+        return false;
+    }
+
+    uint64_t now = SDL_GetPerformanceCounter();
+    uint64_t elapsedCounts = now - previousCounter;
+    previousCounter = now;
+
+    // Clamp long frames, the ticks they would have needed are dropped rather than run all at once
+    double tickTime = 1.0 / tickRate;
+    double elapsed = static_cast<double>(elapsedCounts) / frequency;
+    if (elapsed > GAMELOOP_MAX_FRAME_TIME)
+    {
+        stats.droppedTicks += static_cast<uint64_t>((elapsed - GAMELOOP_MAX_FRAME_TIME) / tickTime);
+        elapsed = GAMELOOP_MAX_FRAME_TIME;
+    }
+
+    accumulator += elapsed;
+    while (accumulator >= tickTime)
+    {
+        if (onTick)
+        {
+            onTick(tickTime);
+        }
+        accumulator -= tickTime;
+        stats.tickCount++;
+    }
+
+    if (onRender)
+    {
+        onRender(accumulator / tickTime);
+    }
+
+    // Pace against an absolute schedule so rounding in one frame does not drift the next
+    uint64_t frameCounts = static_cast<uint64_t>(frequency / GetTargetFrameRate());
+    nextFrameCounter += frameCounts;
+    uint64_t afterRender = SDL_GetPerformanceCounter();
+    if (afterRender > nextFrameCounter + frameCounts)
+    {
+        // More than a frame behind, restart the schedule instead of racing to catch up
+        nextFrameCounter = afterRender;
+    }
+    WaitUntil(nextFrameCounter);
+
+    // The first frame has no previous frame to measure against
+    if (!isFirstFrame)
+    {
+        RecordFrame(elapsedCounts);
+    }
+    started = running;
+    return running;
+}
+
+void Game::Graphics::GameLoop :: Stop()
+{
+    running = false;
+}
+
+bool Game::Graphics::GameLoop :: IsRunning() const
+{
+    return running;
+}
+
+void Game::Graphics::GameLoop :: PumpEvents()
+{
+    SDL_Event event;
+    if (input != nullptr)
+    {
+        input->BeginFrame();
+        input->PumpEvents();
+    }
+    while (input != nullptr ? input->PollEvent(event) : SDL_PollEvent(&event))
+    {
+        window.HandleEvent(event);
+        if (event.type == SDL_QUIT)
+        {
+            running = false;
+        }
+        if (onEvent)
+        {
+            onEvent(event);
+        }
+    }
+}
+
+void Game::Graphics::GameLoop :: WaitUntil(uint64_t target)
+{
+    uint64_t spinCounts = static_cast<uint64_t>(GAMELOOP_SPIN_THRESHOLD * frequency);
+    uint64_t now = SDL_GetPerformanceCounter();
+
+    // Sleep in whole milliseconds while the deadline is further than the spin threshold
+    while (now + spinCounts < target)
+    {
+        uint64_t sleepCounts = target - now - spinCounts;
+        Uint32 milliseconds = static_cast<Uint32>(sleepCounts * 1000 / frequency);
+        SDL_Delay(std::max<Uint32>(milliseconds, 1));
+        now = SDL_GetPerformanceCounter();
+    }
+
+    while (now < target)
+    {
+        now = SDL_GetPerformanceCounter();
+    }
+
+    stats.lastOvershootMilliseconds = target > 0 ? static_cast<double>(now - target) * 1000.0 / frequency : 0;
+}
+
+void Game::Graphics::GameLoop :: RecordFrame(uint64_t frameCounts)
+{
+    double milliseconds = static_cast<double>(frameCounts) * 1000.0 / frequency;
+    stats.frameCount++;
+    stats.lastFrameMilliseconds = milliseconds;
+
+    frameHistory[historyNext] = milliseconds;
+    historyNext = (historyNext + 1) % GAMELOOP_STATS_WINDOW;
+    historyCount = std::min(historyCount + 1, GAMELOOP_STATS_WINDOW);
+
+    double sum = 0;
+    stats.minFrameMilliseconds = frameHistory[0];
+    stats.maxFrameMilliseconds = frameHistory[0];
+    for (size_t i = 0; i < historyCount; i++)
+    {
+        sum += frameHistory[i];
+        stats.minFrameMilliseconds = std::min(stats.minFrameMilliseconds, frameHistory[i]);
+        stats.maxFrameMilliseconds = std::max(stats.maxFrameMilliseconds, frameHistory[i]);
+    }
+    stats.averageFrameMilliseconds = sum / historyCount;
+    stats.framesPerSecond = stats.averageFrameMilliseconds > 0 ? 1000.0 / stats.averageFrameMilliseconds : 0;
+}
+
+const Game::Graphics::FrameStats& Game::Graphics::GameLoop :: GetStats() const
+{
+    return stats;
+}
+
+void Game::Graphics::GameLoop :: ResetStats()
+{
+    stats = FrameStats();
+    historyCount = 0;
+    historyNext = 0;
+}
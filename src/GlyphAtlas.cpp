@@ -0,0 +1,273 @@
+/**
+ *  \file GlyphAtlas.cpp
+ *
+ *  \brief Source file for GlyphAtlas.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Graphics/GlyphAtlas.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+// Decodes one UTF-8 sequence and advances text past it, malformed bytes come out as U+FFFD
+static uint32_t NextCodepoint(const char*& text)
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text);
+    uint32_t codepoint = bytes[0];
+    int length = 1;
+    if (codepoint >= 0x80 && (codepoint < 0xC0 || codepoint >= 0xF8))
+    {
+        text++;
+        return 0xFFFD;
+    }
+    else if (codepoint >= 0xF0)
+    {
+        codepoint &= 0x07;
+        length = 4;
+    }
+    else if (codepoint >= 0xE0)
+    {
+        codepoint &= 0x0F;
+        length = 3;
+    }
+    else if (codepoint >= 0xC0)
+    {
+        codepoint &= 0x1F;
+        length = 2;
+    }
+
+    for (int i = 1; i < length; i++)
+    {
+        if ((bytes[i] & 0xC0) != 0x80)
+        {
+            text += i;
+            return 0xFFFD;
+        }
+        codepoint = (codepoint << 6) | (bytes[i] & 0x3F);
+    }
+    text += length;
+    return codepoint;
+}
+
+Game::Graphics::GlyphAtlas :: GlyphAtlas(TTF_Font* p_font, SDL_Renderer* p_renderer) : font(p_font), renderer(p_renderer), stats()
+{
+    std::fill(asciiGlyphs, asciiGlyphs + GLYPH_ATLAS_ASCII_COUNT, GLYPH_ATLAS_NO_GLYPH);
+}
+
+Game::Graphics::GlyphAtlas :: ~GlyphAtlas()
+{
+    Clear();
+}
+
+void Game::Graphics::GlyphAtlas :: DrawText(SpriteBatch& batch, const char* text, float x, float y, SDL_Color color, int layer)
+{
+    if (font == nullptr || text == nullptr)
+    {
+        return;
+    }
+
+    int lineSkip = TTF_FontLineSkip(font);
+    float penX = x, penY = y;
+    uint32_t previous = 0;
+    while (*text != '\0')
+    {
+        uint32_t codepoint = NextCodepoint(text);
+        if (codepoint == '\n')
+        {
+            penX = x;
+            penY += lineSkip;
+            previous = 0;
+            continue;
+        }
+
+        const Glyph* glyph = GetGlyph(codepoint);
+        if (glyph == nullptr)
+        {
+            continue;
+        }
+        if (previous != 0)
+        {
+            penX += TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+        }
+        if (glyph->w > 0)
+        {
+            batch.Draw(pages[glyph->page], SDL_FRect{ penX, penY, static_cast<float>(glyph->w), static_cast<float>(glyph->h) }, glyph->uv, layer, color);
+            stats.quadsDrawn++;
+        }
+        penX += glyph->advance;
+        previous = codepoint;
+    }
+}
+
+Game::Math::Pair<int, int> Game::Graphics::GlyphAtlas :: MeasureText(const char* text)
+{
+    if (font == nullptr || text == nullptr)
+    {
+        return Math::Pair<int, int>(0, 0);
+    }
+
+    int lineSkip = TTF_FontLineSkip(font);
+    int width = 0, lineWidth = 0, height = TTF_FontHeight(font);
+    uint32_t previous = 0;
+    while (*text != '\0')
+    {
+        uint32_t codepoint = NextCodepoint(text);
+        if (codepoint == '\n')
+        {
+            lineWidth = 0;
+            height += lineSkip;
+            previous = 0;
+            continue;
+        }
+
+        const Glyph* glyph = GetGlyph(codepoint);
+        if (glyph == nullptr)
+        {
+            continue;
+        }
+        if (previous != 0)
+        {
+            lineWidth += TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+        }
+        lineWidth += glyph->advance;
+        width = std::max(width, lineWidth);
+        previous = codepoint;
+    }
+    return Math::Pair<int, int>(width, height);
+}
+
+const Game::Graphics::Glyph* Game::Graphics::GlyphAtlas :: GetGlyph(uint32_t codepoint)
+{
+    uint32_t index = GLYPH_ATLAS_NO_GLYPH;
+    if (codepoint < GLYPH_ATLAS_ASCII_COUNT)
+    {
+        index = asciiGlyphs[codepoint];
+        if (index == GLYPH_ATLAS_NO_GLYPH)
+        {
+            index = asciiGlyphs[codepoint] = Rasterize(codepoint);
+        }
+    }
+    else
+    {
+        auto found = otherGlyphs.find(codepoint);
+        if (found != otherGlyphs.end())
+        {
+            index = found->second;
+        }
+        else
+        {
+            index = Rasterize(codepoint);
+            otherGlyphs.emplace(codepoint, index);
+        }
+    }
+    return index != GLYPH_ATLAS_NO_GLYPH ? &glyphs[index] : nullptr;
+}
+
+void Game::Graphics::GlyphAtlas :: Clear()
+{
+    for (SDL_Texture* page : pages)
+    {
+        SDL_DestroyTexture(page);
+    }
+    pages.clear();
+    glyphs.clear();
+    otherGlyphs.clear();
+    std::fill(asciiGlyphs, asciiGlyphs + GLYPH_ATLAS_ASCII_COUNT, GLYPH_ATLAS_NO_GLYPH);
+    stats.pageCount = 0;
+}
+
+TTF_Font* Game::Graphics::GlyphAtlas :: GetFont() const
+{
+    return font;
+}
+
+SDL_Renderer* Game::Graphics::GlyphAtlas :: GetRenderer() const
+{
+    return renderer;
+}
+
+SDL_Texture* Game::Graphics::GlyphAtlas :: GetTexture(int page) const
+{
+    return page >= 0 && static_cast<size_t>(page) < pages.size() ? pages[page] : nullptr;
+}
+
+const Game::Graphics::GlyphAtlasStats& Game::Graphics::GlyphAtlas :: GetStats() const
+{
+    return stats;
+}
+
+uint32_t Game::Graphics::GlyphAtlas :: Rasterize(uint32_t codepoint)
+{
+    int advance = 0;
+    if (font == nullptr || TTF_GlyphMetrics32(font, codepoint, nullptr, nullptr, nullptr, nullptr, &advance) != 0)
+    {
+        return GLYPH_ATLAS_NO_GLYPH;
+    }
+
+    Glyph glyph = { SDL_FRect{ 0, 0, 0, 0 }, 0, 0, advance, -1 };
+
+    // The surface spans the advance and the font height with the glyph at its bearing, so it is drawn at the pen
+    SDL_Surface* rendered = TTF_RenderGlyph32_Blended(font, codepoint, SDL_Color{ 255, 255, 255, 255 });
+    SDL_Surface* surface = rendered != nullptr ? SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_ARGB8888, 0) : nullptr;
+    if (rendered != nullptr)
+    {
+        SDL_FreeSurface(rendered);
+    }
+
+    if (surface != nullptr && surface->w > 0 && surface->h > 0)
+    {
+        SDL_Rect placed;
+        int w = surface->w + ATLAS_DEFAULT_PADDING * 2, h = surface->h + ATLAS_DEFAULT_PADDING * 2;
+        bool isPlaced = !pages.empty() && packer.Insert(w, h, placed);
+        if (!isPlaced && AddPage() >= 0)
+        {
+            isPlaced = packer.Insert(w, h, placed);
+        }
+
+        if (isPlaced)
+        {
+            SDL_Rect rect = { placed.x + ATLAS_DEFAULT_PADDING, placed.y + ATLAS_DEFAULT_PADDING, surface->w, surface->h };
+            SDL_UpdateTexture(pages.back(), &rect, surface->pixels, surface->pitch);
+            glyph.uv = SDL_FRect{ static_cast<float>(rect.x) / GLYPH_ATLAS_PAGE_SIZE, static_cast<float>(rect.y) / GLYPH_ATLAS_PAGE_SIZE,
+                                  static_cast<float>(rect.w) / GLYPH_ATLAS_PAGE_SIZE, static_cast<float>(rect.h) / GLYPH_ATLAS_PAGE_SIZE };
+            glyph.w = rect.w;
+            glyph.h = rect.h;
+            glyph.page = static_cast<int>(pages.size()) - 1;
+            stats.glyphsRasterized++;
+        }
+        else
+        {
+            std::cerr << "GlyphAtlas: Glyph " << codepoint << " does not fit on a page" << std::endl;
+        }
+    }
+
+    if (surface != nullptr)
+    {
+        SDL_FreeSurface(surface);
+    }
+    glyphs.push_back(glyph);
+    return static_cast<uint32_t>(glyphs.size() - 1);
+}
+
+int Game::Graphics::GlyphAtlas :: AddPage()
+{
+    SDL_Texture* page = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, GLYPH_ATLAS_PAGE_SIZE, GLYPH_ATLAS_PAGE_SIZE);
+    if (page == nullptr)
+    {
+        std::cerr << "GlyphAtlas: Can't create a page: " << SDL_GetError() << std::endl;
+        return -1;
+    }
+
+    // Padding around the glyphs must be transparent, static textures start undefined
+    Math::DynamicArray<uint32_t> clear(static_cast<size_t>(GLYPH_ATLAS_PAGE_SIZE) * GLYPH_ATLAS_PAGE_SIZE, 0);
+    SDL_UpdateTexture(page, nullptr, clear.data(), GLYPH_ATLAS_PAGE_SIZE * 4);
+    SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+
+    pages.push_back(page);
+    packer.Reset(GLYPH_ATLAS_PAGE_SIZE, GLYPH_ATLAS_PAGE_SIZE);
+    stats.pageCount = pages.size();
+    return static_cast<int>(pages.size()) - 1;
+}
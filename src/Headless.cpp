@@ -0,0 +1,211 @@
+/**
+ *  \file Headless.cpp
+ *
+ *  \brief Source file for Headless.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Graphics/Headless.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+#include "SDL2/SDL_image.h"
+#include "SDL2/SDL_ttf.h"
+
+// Returns the surface itself if it is already RGBA32, a converted copy otherwise
+static SDL_Surface* AsRGBA32(SDL_Surface* surface)
+{
+    if (surface->format->format == Game::Graphics::HEADLESS_PIXEL_FORMAT)
+    {
+        return surface;
+    }
+    return SDL_ConvertSurfaceFormat(surface, Game::Graphics::HEADLESS_PIXEL_FORMAT, 0);
+}
+
+Game::Graphics::HeadlessTarget :: HeadlessTarget(int p_w, int p_h) : surface(nullptr), renderer(nullptr)
+{
+    Resize(p_w, p_h);
+}
+
+Game::Graphics::HeadlessTarget :: ~HeadlessTarget()
+{
+    Destroy();
+}
+
+bool Game::Graphics::HeadlessTarget :: Resize(int w, int h)
+{
+    Destroy();
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, HEADLESS_PIXEL_FORMAT);
+    if (surface == nullptr)
+    {
+        std::cerr << "HeadlessTarget: Can't create a " << w << "x" << h << " surface: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    renderer = SDL_CreateSoftwareRenderer(surface);
+    if (renderer == nullptr)
+    {
+        std::cerr << "HeadlessTarget: Can't create the software renderer: " << SDL_GetError() << std::endl;
+        Destroy();
+        return false;
+    }
+    return true;
+}
+
+void Game::Graphics::HeadlessTarget :: Clear(SDL_Color color)
+{
+    if (renderer != nullptr)
+    {
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        SDL_RenderClear(renderer);
+    }
+}
+
+bool Game::Graphics::HeadlessTarget :: SavePNG(const char* path) const
+{
+    if (surface == nullptr || IMG_SavePNG(surface, path) != 0)
+    {
+        std::cerr << "HeadlessTarget: Can't save " << path << ": " << IMG_GetError() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+SDL_Renderer* Game::Graphics::HeadlessTarget :: GetRenderer() const
+{
+    return renderer;
+}
+
+SDL_Surface* Game::Graphics::HeadlessTarget :: GetSurface() const
+{
+    return surface;
+}
+
+bool Game::Graphics::HeadlessTarget :: IsValid() const
+{
+    return renderer != nullptr;
+}
+
+void Game::Graphics::HeadlessTarget :: Destroy()
+{
+    if (renderer != nullptr)
+    {
+        SDL_DestroyRenderer(renderer);
+        renderer = nullptr;
+    }
+    if (surface != nullptr)
+    {
+        SDL_FreeSurface(surface);
+        surface = nullptr;
+    }
+}
+
+bool Game::Graphics::Headless_Init()
+{
+    // The hint only applies before the video subsystem starts
+    SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS) < 0)
+    {
+        std::cerr << "Error initializing SDL headless: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    if (IMG_Init(IMG_INIT_PNG | IMG_INIT_JPG) == 0)
+    {
+        std::cerr << "Error initializing SDL_image: " << IMG_GetError() << std::endl;
+        SDL_Quit();
+        return false;
+    }
+
+    if (TTF_Init() == -1)
+    {
+        std::cerr << "Error initializing SDL_ttf: " << TTF_GetError() << std::endl;
+        IMG_Quit();
+        SDL_Quit();
+        return false;
+    }
+    return true;
+}
+
+Game::Graphics::PixelDiff Game::Graphics::Headless_Compare(SDL_Surface* a, SDL_Surface* b, int tolerance)
+{
+    PixelDiff diff = { false, 0, 0, SDL_Rect{ 0, 0, 0, 0 } };
+    if (a == nullptr || b == nullptr || a->w != b->w || a->h != b->h)
+    {
+        return diff;
+    }
+    diff.sizeMatches = true;
+
+    SDL_Surface* rgbaA = AsRGBA32(a);
+    SDL_Surface* rgbaB = AsRGBA32(b);
+    if (rgbaA == nullptr || rgbaB == nullptr)
+    {
+        std::cerr << "Headless_Compare: Can't convert the images: " << SDL_GetError() << std::endl;
+        diff.sizeMatches = false;
+    }
+    else
+    {
+        SDL_LockSurface(rgbaA);
+        SDL_LockSurface(rgbaB);
+
+        int minX = a->w, minY = a->h, maxX = -1, maxY = -1;
+        for (int y = 0; y < a->h; y++)
+        {
+            const Uint8* rowA = static_cast<const Uint8*>(rgbaA->pixels) + static_cast<size_t>(y) * rgbaA->pitch;
+            const Uint8* rowB = static_cast<const Uint8*>(rgbaB->pixels) + static_cast<size_t>(y) * rgbaB->pitch;
+            for (int x = 0; x < a->w; x++)
+            {
+                int difference = 0;
+                for (int channel = 0; channel < 4; channel++)
+                {
+                    difference = std::max(difference, std::abs(rowA[x * 4 + channel] - rowB[x * 4 + channel]));
+                }
+                diff.maxDifference = std::max(diff.maxDifference, difference);
+                if (difference > tolerance)
+                {
+                    diff.differentPixels++;
+                    minX = std::min(minX, x);
+                    minY = std::min(minY, y);
+                    maxX = std::max(maxX, x);
+                    maxY = std::max(maxY, y);
+                }
+            }
+        }
+        if (diff.differentPixels > 0)
+        {
+            diff.bounds = SDL_Rect{ minX, minY, maxX - minX + 1, maxY - minY + 1 };
+        }
+
+        SDL_UnlockSurface(rgbaA);
+        SDL_UnlockSurface(rgbaB);
+    }
+
+    if (rgbaA != nullptr && rgbaA != a)
+    {
+        SDL_FreeSurface(rgbaA);
+    }
+    if (rgbaB != nullptr && rgbaB != b)
+    {
+        SDL_FreeSurface(rgbaB);
+    }
+    return diff;
+}
+
+Game::Graphics::PixelDiff Game::Graphics::Headless_CompareFile(SDL_Surface* image, const char* referencePath, int tolerance)
+{
+    SDL_Surface* reference = IMG_Load(referencePath);
+    if (reference == nullptr)
+    {
+        std::cerr << "Headless_CompareFile: Can't load " << referencePath << ": " << IMG_GetError() << std::endl;
+        return PixelDiff{ false, 0, 0, SDL_Rect{ 0, 0, 0, 0 } };
+    }
+
+    PixelDiff diff = Headless_Compare(image, reference, tolerance);
+    SDL_FreeSurface(reference);
+    return diff;
+}
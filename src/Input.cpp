@@ -0,0 +1,317 @@
+/**
+ *  \file Input.cpp
+ *
+ *  \brief Source file for Input.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Input/Input.hpp"
+
+#include <iostream>
+
+Game::Input::EventRing :: EventRing() : events(INPUT_EVENT_CAPACITY), head(0), size(0), droppedCount(0)
+{
+
+}
+
+void Game::Input::EventRing :: Push(const SDL_Event& event)
+{
+    if (size == events.size())
+    {
+        head = (head + 1) % events.size();
+        size--;
+        droppedCount++;
+    }
+    events[(head + size) % events.size()] = event;
+    size++;
+}
+
+bool Game::Input::EventRing :: Pop(SDL_Event& event)
+{
+    if (size == 0)
+    {
+        return false;
+    }
+    event = events[head];
+    head = (head + 1) % events.size();
+    size--;
+    return true;
+}
+
+void Game::Input::EventRing :: Clear()
+{
+    head = 0;
+    size = 0;
+}
+
+size_t Game::Input::EventRing :: GetSize() const
+{
+    return size;
+}
+
+uint64_t Game::Input::EventRing :: GetDroppedCount() const
+{
+    return droppedCount;
+}
+
+Game::Input::InputSystem :: InputSystem() : mousePosition(0, 0), mouseDelta(0, 0), mouseWheel(0, 0), isQuitRequested(false), eventCount(0)
+{
+    for (ControllerState& state : controllers)
+    {
+        state = ControllerState();
+        state.controller = nullptr;
+        state.instanceId = -1;
+    }
+}
+
+Game::Input::InputSystem :: ~InputSystem()
+{
+    for (ControllerState& state : controllers)
+    {
+        if (state.controller != nullptr)
+        {
+            SDL_GameControllerClose(state.controller);
+            state.controller = nullptr;
+        }
+    }
+}
+
+void Game::Input::InputSystem :: BeginFrame()
+{
+    keys.BeginFrame();
+    mouseButtons.BeginFrame();
+    for (ControllerState& state : controllers)
+    {
+        state.buttons.BeginFrame();
+    }
+    mouseDelta = Math::Pair<int, int>(0, 0);
+    mouseWheel = Math::Pair<float, float>(0, 0);
+}
+
+size_t Game::Input::InputSystem :: PumpEvents()
+{
+    SDL_PumpEvents();
+
+    // A short batch means the queue is empty
+    size_t total = 0;
+    int count = 0;
+    do
+    {
+        count = SDL_PeepEvents(batch, INPUT_PEEP_BATCH, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+        if (count < 0)
+        {
+            std::cerr << "InputSystem: SDL_PeepEvents failed: " << SDL_GetError() << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            HandleEvent(batch[i]);
+            ring.Push(batch[i]);
+        }
+        total += count;
+    } while (count == INPUT_PEEP_BATCH);
+
+    eventCount += total;
+    return total;
+}
+
+void Game::Input::InputSystem :: HandleEvent(const SDL_Event& event)
+{
+    switch (event.type)
+    {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            keys.Set(static_cast<size_t>(event.key.keysym.scancode), event.type == SDL_KEYDOWN);
+            break;
+        case SDL_MOUSEMOTION:
+            mousePosition = Math::Pair<int, int>(event.motion.x, event.motion.y);
+            mouseDelta.first += event.motion.xrel;
+            mouseDelta.second += event.motion.yrel;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            mouseButtons.Set(static_cast<size_t>(event.button.button) - 1, event.type == SDL_MOUSEBUTTONDOWN);
+            mousePosition = Math::Pair<int, int>(event.button.x, event.button.y);
+            break;
+        case SDL_MOUSEWHEEL:
+            mouseWheel.first += event.wheel.preciseX;
+            mouseWheel.second += event.wheel.preciseY;
+            break;
+        case SDL_CONTROLLERDEVICEADDED:
+            AddController(event.cdevice.which);
+            break;
+        case SDL_CONTROLLERDEVICEREMOVED:
+            RemoveController(event.cdevice.which);
+            break;
+        case SDL_CONTROLLERBUTTONDOWN:
+        case SDL_CONTROLLERBUTTONUP:
+        {
+            ControllerState* state = FindController(event.cbutton.which);
+            if (state != nullptr)
+            {
+                state->buttons.Set(event.cbutton.button, event.type == SDL_CONTROLLERBUTTONDOWN);
+            }
+            break;
+        }
+        case SDL_CONTROLLERAXISMOTION:
+        {
+            ControllerState* state = FindController(event.caxis.which);
+            if (state != nullptr && event.caxis.axis < INPUT_CONTROLLER_AXES)
+            {
+                state->axes[event.caxis.axis] = event.caxis.value < 0 ? event.caxis.value / 32768.0f : event.caxis.value / 32767.0f;
+            }
+            break;
+        }
+        case SDL_QUIT:
+            isQuitRequested = true;
+            break;
+        default:
+            break;
+    }
+}
+
+bool Game::Input::InputSystem :: PollEvent(SDL_Event& event)
+{
+    return ring.Pop(event);
+}
+
+const Game::Input::EventRing& Game::Input::InputSystem :: GetEventRing() const
+{
+    return ring;
+}
+
+bool Game::Input::InputSystem :: IsKeyDown(SDL_Scancode key) const
+{
+    return key >= 0 && key < SDL_NUM_SCANCODES && keys.down.test(key);
+}
+
+bool Game::Input::InputSystem :: WasKeyPressed(SDL_Scancode key) const
+{
+    return key >= 0 && key < SDL_NUM_SCANCODES && keys.pressed.test(key);
+}
+
+bool Game::Input::InputSystem :: WasKeyReleased(SDL_Scancode key) const
+{
+    return key >= 0 && key < SDL_NUM_SCANCODES && keys.released.test(key);
+}
+
+bool Game::Input::InputSystem :: IsMouseButtonDown(int button) const
+{
+    return button >= 1 && button <= INPUT_MOUSE_BUTTONS && mouseButtons.down.test(button - 1);
+}
+
+bool Game::Input::InputSystem :: WasMouseButtonPressed(int button) const
+{
+    return button >= 1 && button <= INPUT_MOUSE_BUTTONS && mouseButtons.pressed.test(button - 1);
+}
+
+bool Game::Input::InputSystem :: WasMouseButtonReleased(int button) const
+{
+    return button >= 1 && button <= INPUT_MOUSE_BUTTONS && mouseButtons.released.test(button - 1);
+}
+
+Game::Math::Pair<int, int> Game::Input::InputSystem :: GetMousePosition() const
+{
+    return mousePosition;
+}
+
+Game::Math::Pair<int, int> Game::Input::InputSystem :: GetMouseDelta() const
+{
+    return mouseDelta;
+}
+
+Game::Math::Pair<float, float> Game::Input::InputSystem :: GetMouseWheel() const
+{
+    return mouseWheel;
+}
+
+bool Game::Input::InputSystem :: IsControllerConnected(int slot) const
+{
+    return slot >= 0 && slot < INPUT_MAX_CONTROLLERS && controllers[slot].controller != nullptr;
+}
+
+bool Game::Input::InputSystem :: IsControllerButtonDown(int slot, SDL_GameControllerButton button) const
+{
+    return IsControllerConnected(slot) && button >= 0 && button < INPUT_CONTROLLER_BUTTONS && controllers[slot].buttons.down.test(button);
+}
+
+bool Game::Input::InputSystem :: WasControllerButtonPressed(int slot, SDL_GameControllerButton button) const
+{
+    return IsControllerConnected(slot) && button >= 0 && button < INPUT_CONTROLLER_BUTTONS && controllers[slot].buttons.pressed.test(button);
+}
+
+bool Game::Input::InputSystem :: WasControllerButtonReleased(int slot, SDL_GameControllerButton button) const
+{
+    return IsControllerConnected(slot) && button >= 0 && button < INPUT_CONTROLLER_BUTTONS && controllers[slot].buttons.released.test(button);
+}
+
+float Game::Input::InputSystem :: GetControllerAxis(int slot, SDL_GameControllerAxis axis) const
+{
+    if (!IsControllerConnected(slot) || axis < 0 || axis >= INPUT_CONTROLLER_AXES)
+    {
+        return 0;
+    }
+    return controllers[slot].axes[axis];
+}
+
+bool Game::Input::InputSystem :: IsQuitRequested() const
+{
+    return isQuitRequested;
+}
+
+uint64_t Game::Input::InputSystem :: GetEventCount() const
+{
+    return eventCount;
+}
+
+void Game::Input::InputSystem :: AddController(int deviceIndex)
+{
+    for (ControllerState& state : controllers)
+    {
+        if (state.controller != nullptr)
+        {
+            continue;
+        }
+
+        state.controller = SDL_GameControllerOpen(deviceIndex);
+        if (state.controller == nullptr)
+        {
+            std::cerr << "InputSystem: Failed to open controller " << deviceIndex << ": " << SDL_GetError() << std::endl;
+            return;
+        }
+        state.instanceId = SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(state.controller));
+        state.buttons = ButtonState<INPUT_CONTROLLER_BUTTONS>();
+        for (float& axis : state.axes)
+        {
+            axis = 0;
+        }
+        return;
+    }
+    std::cerr << "InputSystem: No free controller slot for device " << deviceIndex << std::endl;
+}
+
+void Game::Input::InputSystem :: RemoveController(SDL_JoystickID instanceId)
+{
+    ControllerState* state = FindController(instanceId);
+    if (state != nullptr)
+    {
+        SDL_GameControllerClose(state->controller);
+        state->controller = nullptr;
+        state->instanceId = -1;
+    }
+}
+
+Game::Input::ControllerState* Game::Input::InputSystem :: FindController(SDL_JoystickID instanceId)
+{
+    for (ControllerState& state : controllers)
+    {
+        if (state.controller != nullptr && state.instanceId == instanceId)
+        {
+            return &state;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,347 @@
+/**
+ *  \file KDTree.cpp
+ *
+ *  \brief Source file for KDTree.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Math/KDTree.hpp"
+
+#include <algorithm>
+#include <utility>
+
+template <typename T>
+static constexpr int Dimensions(const Game::Math::Point2D<T>*)
+{
+    return 2;
+}
+
+template <typename T>
+static constexpr int Dimensions(const Game::Math::Point3D<T>*)
+{
+    return 3;
+}
+
+template <typename T>
+static T Coordinate(const Game::Math::Point2D<T>& point, int axis)
+{
+    return axis == 0 ? point.x : point.y;
+}
+
+template <typename T>
+static T Coordinate(const Game::Math::Point3D<T>& point, int axis)
+{
+    return axis == 0 ? point.x : (axis == 1 ? point.y : point.z);
+}
+
+template <typename T>
+static T DistanceSquared(const Game::Math::Point2D<T>& a, const Game::Math::Point2D<T>& b)
+{
+    T dx = a.x - b.x, dy = a.y - b.y;
+    return dx * dx + dy * dy;
+}
+
+template <typename T>
+static T DistanceSquared(const Game::Math::Point3D<T>& a, const Game::Math::Point3D<T>& b)
+{
+    T dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+template <typename Point>
+Game::Math::KDTree<Point> :: KDTree()
+{
+
+}
+
+template <typename Point>
+void Game::Math::KDTree<Point> :: Build(const Point* p_points, size_t count)
+{
+    // The build permutes ids only, points are gathered once at the end
+    ids.resize(count);
+    axes.assign(count, 0);
+    for (size_t i = 0; i < count; i++)
+    {
+        ids[i] = static_cast<uint32_t>(i);
+    }
+
+    BuildRange(p_points, 0, count);
+
+    points.clear();
+    points.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        points.push_back(p_points[ids[i]]);
+    }
+}
+
+template <typename Point>
+void Game::Math::KDTree<Point> :: BuildRange(const Point* source, size_t begin, size_t end)
+{
+    if (end - begin <= KDTREE_LEAF_SIZE)
+    {
+        return;
+    }
+
+    // Split on the axis with the widest spread, it adapts to flat and clustered sets
+    constexpr int dimensions = Dimensions(static_cast<const Point*>(nullptr));
+    Scalar minimum[dimensions], maximum[dimensions];
+    for (int axis = 0; axis < dimensions; axis++)
+    {
+        minimum[axis] = maximum[axis] = Coordinate(source[ids[begin]], axis);
+    }
+    for (size_t i = begin + 1; i < end; i++)
+    {
+        for (int axis = 0; axis < dimensions; axis++)
+        {
+            Scalar value = Coordinate(source[ids[i]], axis);
+            minimum[axis] = std::min(minimum[axis], value);
+            maximum[axis] = std::max(maximum[axis], value);
+        }
+    }
+
+    int splitAxis = 0;
+    for (int axis = 1; axis < dimensions; axis++)
+    {
+        if (maximum[axis] - minimum[axis] > maximum[splitAxis] - minimum[splitAxis])
+        {
+            splitAxis = axis;
+        }
+    }
+
+    size_t middle = begin + (end - begin) / 2;
+    std::nth_element(ids.begin() + begin, ids.begin() + middle, ids.begin() + end, [source, splitAxis](uint32_t a, uint32_t b)
+    {
+        return Coordinate(source[a], splitAxis) < Coordinate(source[b], splitAxis);
+    });
+
+    axes[middle] = static_cast<uint8_t>(splitAxis);
+    BuildRange(source, begin, middle);
+    BuildRange(source, middle + 1, end);
+}
+
+template <typename Point>
+void Game::Math::KDTree<Point> :: Clear()
+{
+    points.clear();
+    ids.clear();
+    axes.clear();
+}
+
+template <typename Point>
+void Game::Math::KDTree<Point> :: QueryNearest(const Point& point, size_t k, DynamicArray<uint32_t>& results) const
+{
+    results.clear();
+    if (points.empty() || k == 0)
+    {
+        return;
+    }
+
+    // Max heap of the k best so far, ties broken by id so results do not depend on layout
+    DynamicArray<Pair<Scalar, uint32_t>> best;
+    best.reserve(k + 1);
+    NearestRange(0, points.size(), point, k, best);
+
+    std::sort_heap(best.begin(), best.end());
+    for (const Pair<Scalar, uint32_t>& item : best)
+    {
+        results.push_back(item.second);
+    }
+}
+
+template <typename Point>
+void Game::Math::KDTree<Point> :: NearestRange(size_t begin, size_t end, const Point& point, size_t k, DynamicArray<Pair<Scalar, uint32_t>>& best) const
+{
+    auto consider = [&](size_t index)
+    {
+        Pair<Scalar, uint32_t> item(DistanceSquared(points[index], point), ids[index]);
+        if (best.size() < k)
+        {
+            best.push_back(item);
+            std::push_heap(best.begin(), best.end());
+        }
+        else if (item < best.front())
+        {
+            std::pop_heap(best.begin(), best.end());
+            best.back() = item;
+            std::push_heap(best.begin(), best.end());
+        }
+    };
+
+    if (end - begin <= KDTREE_LEAF_SIZE)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            consider(i);
+        }
+        return;
+    }
+
+    size_t middle = begin + (end - begin) / 2;
+    int axis = axes[middle];
+    Scalar delta = Coordinate(point, axis) - Coordinate(points[middle], axis);
+
+    // Near side first, the far side only if the splitting plane is closer than the worst kept
+    if (delta < 0)
+    {
+        NearestRange(begin, middle, point, k, best);
+    }
+    else
+    {
+        NearestRange(middle + 1, end, point, k, best);
+    }
+
+    consider(middle);
+    if (best.size() < k || delta * delta <= best.front().first)
+    {
+        if (delta < 0)
+        {
+            NearestRange(middle + 1, end, point, k, best);
+        }
+        else
+        {
+            NearestRange(begin, middle, point, k, best);
+        }
+    }
+}
+
+template <typename Point>
+void Game::Math::KDTree<Point> :: QueryRadius(const Point& point, const Scalar radius, DynamicArray<uint32_t>& results) const
+{
+    results.clear();
+    if (points.empty() || radius < 0)
+    {
+        return;
+    }
+
+    RadiusRange(0, points.size(), point, radius * radius, results);
+}
+
+template <typename Point>
+void Game::Math::KDTree<Point> :: RadiusRange(size_t begin, size_t end, const Point& point, const Scalar radiusSquared, DynamicArray<uint32_t>& results) const
+{
+    if (end - begin <= KDTREE_LEAF_SIZE)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            if (DistanceSquared(points[i], point) <= radiusSquared)
+            {
+                results.push_back(ids[i]);
+            }
+        }
+        return;
+    }
+
+    size_t middle = begin + (end - begin) / 2;
+    int axis = axes[middle];
+    Scalar delta = Coordinate(point, axis) - Coordinate(points[middle], axis);
+
+    if (DistanceSquared(points[middle], point) <= radiusSquared)
+    {
+        results.push_back(ids[middle]);
+    }
+    if (delta <= 0 || delta * delta <= radiusSquared)
+    {
+        RadiusRange(begin, middle, point, radiusSquared, results);
+    }
+    if (delta >= 0 || delta * delta <= radiusSquared)
+    {
+        RadiusRange(middle + 1, end, point, radiusSquared, results);
+    }
+}
+
+template <typename Point>
+size_t Game::Math::KDTree<Point> :: GetPointCount() const
+{
+    return points.size();
+}
+
+template <typename Point>
+bool Game::Math::KDTree<Point> :: IsEmpty() const
+{
+    return points.empty();
+}
+
+template <typename Point>
+Game::Math::KDTreeRebuilder<Point> :: KDTreeRebuilder(Utils::ThreadPool& p_pool) : pool(p_pool), building(false), ready(false), swapCount(0)
+{
+
+}
+
+template <typename Point>
+Game::Math::KDTreeRebuilder<Point> :: ~KDTreeRebuilder()
+{
+    // The job still references back and input
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return !building; });
+}
+
+template <typename Point>
+bool Game::Math::KDTreeRebuilder<Point> :: BeginRebuild(const Point* points, size_t count)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (building || ready)
+        {
+            return false;
+        }
+        building = true;
+    }
+
+    input.assign(points, points + count);
+    pool.Submit([this]()
+    {
+        back.Build(input.data(), input.size());
+
+        std::lock_guard<std::mutex> lock(mutex);
+        building = false;
+        ready = true;
+        finished.notify_all();
+    });
+    return true;
+}
+
+template <typename Point>
+bool Game::Math::KDTreeRebuilder<Point> :: Swap()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!ready)
+    {
+        return false;
+    }
+
+    std::swap(front, back);
+    ready = false;
+    swapCount++;
+    return true;
+}
+
+template <typename Point>
+const Game::Math::KDTree<Point>& Game::Math::KDTreeRebuilder<Point> :: GetTree() const
+{
+    return front;
+}
+
+template <typename Point>
+bool Game::Math::KDTreeRebuilder<Point> :: IsBuilding() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return building;
+}
+
+template <typename Point>
+uint64_t Game::Math::KDTreeRebuilder<Point> :: GetSwapCount() const
+{
+    return swapCount;
+}
+
+template class Game::Math::KDTree<Game::Math::Point2D<float>>;
+template class Game::Math::KDTree<Game::Math::Point2D<double>>;
+template class Game::Math::KDTree<Game::Math::Point3D<float>>;
+template class Game::Math::KDTree<Game::Math::Point3D<double>>;
+template class Game::Math::KDTreeRebuilder<Game::Math::Point2D<float>>;
+template class Game::Math::KDTreeRebuilder<Game::Math::Point2D<double>>;
+template class Game::Math::KDTreeRebuilder<Game::Math::Point3D<float>>;
+template class Game::Math::KDTreeRebuilder<Game::Math::Point3D<double>>;
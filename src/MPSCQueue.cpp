@@ -0,0 +1,75 @@
+/**
+ *  \file MPSCQueue.cpp
+ *
+ *  \brief Source file for MPSCQueue.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Utils/MPSCQueue.hpp"
+
+Game::Utils::MPSCQueue :: MPSCQueue(size_t p_capacity) : mask(0), tail(0), head(0)
+{
+    size_t capacity = 2;
+    while (capacity < p_capacity)
+    {
+        capacity *= 2;
+    }
+    mask = capacity - 1;
+
+    cells.reset(new Cell[capacity]);
+    for (size_t i = 0; i < capacity; i++)
+    {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+        cells[i].value = 0;
+    }
+}
+
+bool Game::Utils::MPSCQueue :: Push(uint32_t value)
+{
+    // A cell is free for position p when its sequence is p, it was read one lap ago
+    size_t position = tail.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Cell& cell = cells[position & mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (difference == 0)
+        {
+            if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                cell.value = value;
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool Game::Utils::MPSCQueue :: Pop(uint32_t& value)
+{
+    Cell& cell = cells[head & mask];
+    if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+    {
+        return false;
+    }
+
+    value = cell.value;
+    cell.sequence.store(head + mask + 1, std::memory_order_release);
+    head++;
+    return true;
+}
+
+size_t Game::Utils::MPSCQueue :: GetCapacity() const
+{
+    return mask + 1;
+}
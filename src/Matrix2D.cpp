@@ -401,3 +401,6 @@ std::ostream& operator<<(std::ostream& str, Game::Math::Matrix2D<T>& mat)
     str << "[ " << mat.GetElement(0, 0) << ", " << mat.GetElement(0, 1) << "\n  " << mat.GetElement(1, 0) << ", " << mat.GetElement(1, 1) << " ] " << "\n";
     return str;
 }
+
+template struct Game::Math::Matrix2D<float>;
+template struct Game::Math::Matrix2D<double>;
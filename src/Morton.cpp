@@ -0,0 +1,212 @@
+/**
+ *  \file Morton.cpp
+ *
+ *  \brief Source file for Morton.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Math/Morton.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+constexpr uint32_t MORTON_MASK_2D_X = 0x55555555;
+constexpr uint64_t MORTON_MASK_3D_X = 0x1249249249249249ull;
+
+#if !defined(__BMI2__)
+// Spreads the low 16 bits so there is a zero bit between each of them
+static uint32_t Part1By1(uint32_t value)
+{
+    value &= 0x0000FFFF;
+    value = (value | (value << 8)) & 0x00FF00FF;
+    value = (value | (value << 4)) & 0x0F0F0F0F;
+    value = (value | (value << 2)) & 0x33333333;
+    value = (value | (value << 1)) & 0x55555555;
+    return value;
+}
+
+static uint32_t Compact1By1(uint32_t value)
+{
+    value &= 0x55555555;
+    value = (value | (value >> 1)) & 0x33333333;
+    value = (value | (value >> 2)) & 0x0F0F0F0F;
+    value = (value | (value >> 4)) & 0x00FF00FF;
+    value = (value | (value >> 8)) & 0x0000FFFF;
+    return value;
+}
+
+// Spreads the low 21 bits so there are two zero bits between each of them
+static uint64_t Part1By2(uint64_t value)
+{
+    value &= 0x1FFFFF;
+    value = (value | (value << 32)) & 0x001F00000000FFFFull;
+    value = (value | (value << 16)) & 0x001F0000FF0000FFull;
+    value = (value | (value << 8)) & 0x100F00F00F00F00Full;
+    value = (value | (value << 4)) & 0x10C30C30C30C30C3ull;
+    value = (value | (value << 2)) & 0x1249249249249249ull;
+    return value;
+}
+
+static uint64_t Compact1By2(uint64_t value)
+{
+    value &= 0x1249249249249249ull;
+    value = (value | (value >> 2)) & 0x10C30C30C30C30C3ull;
+    value = (value | (value >> 4)) & 0x100F00F00F00F00Full;
+    value = (value | (value >> 8)) & 0x001F0000FF0000FFull;
+    value = (value | (value >> 16)) & 0x001F00000000FFFFull;
+    value = (value | (value >> 32)) & 0x1FFFFF;
+    return value;
+}
+#endif
+
+uint32_t Game::Math::Morton_Encode2D(uint16_t x, uint16_t y)
+{
+#if defined(__BMI2__)
+    return _pdep_u32(x, MORTON_MASK_2D_X) | _pdep_u32(y, MORTON_MASK_2D_X << 1);
+#else
+    return Part1By1(x) | (Part1By1(y) << 1);
+#endif
+}
+
+void Game::Math::Morton_Decode2D(uint32_t code, uint16_t& x, uint16_t& y)
+{
+#if defined(__BMI2__)
+    x = static_cast<uint16_t>(_pext_u32(code, MORTON_MASK_2D_X));
+    y = static_cast<uint16_t>(_pext_u32(code, MORTON_MASK_2D_X << 1));
+#else
+    x = static_cast<uint16_t>(Compact1By1(code));
+    y = static_cast<uint16_t>(Compact1By1(code >> 1));
+#endif
+}
+
+uint64_t Game::Math::Morton_Encode3D(uint32_t x, uint32_t y, uint32_t z)
+{
+#if defined(__BMI2__)
+    return _pdep_u64(x, MORTON_MASK_3D_X) | _pdep_u64(y, MORTON_MASK_3D_X << 1) | _pdep_u64(z, MORTON_MASK_3D_X << 2);
+#else
+    return Part1By2(x) | (Part1By2(y) << 1) | (Part1By2(z) << 2);
+#endif
+}
+
+void Game::Math::Morton_Decode3D(uint64_t code, uint32_t& x, uint32_t& y, uint32_t& z)
+{
+#if defined(__BMI2__)
+    x = static_cast<uint32_t>(_pext_u64(code, MORTON_MASK_3D_X));
+    y = static_cast<uint32_t>(_pext_u64(code, MORTON_MASK_3D_X << 1));
+    z = static_cast<uint32_t>(_pext_u64(code, MORTON_MASK_3D_X << 2));
+#else
+    x = static_cast<uint32_t>(Compact1By2(code));
+    y = static_cast<uint32_t>(Compact1By2(code >> 1));
+    z = static_cast<uint32_t>(Compact1By2(code >> 2));
+#endif
+}
+
+template <typename T>
+static uint32_t Quantize(const T value, const T origin, const T cellSize, const uint32_t maxCoordinate)
+{
+    // Written so NaN lands in cell 0
+    T cell = std::floor((value - origin) / cellSize);
+    if (!(cell > 0))
+    {
+        return 0;
+    }
+    return cell >= static_cast<T>(maxCoordinate) ? maxCoordinate : static_cast<uint32_t>(cell);
+}
+
+template <typename T>
+uint32_t Game::Math::Morton_Key2D(const Point2D<T>& point, const Point2D<T>& origin, const T cellSize)
+{
+    return Morton_Encode2D(static_cast<uint16_t>(Quantize(point.x, origin.x, cellSize, MORTON_MAX_COORDINATE_2D)),
+                           static_cast<uint16_t>(Quantize(point.y, origin.y, cellSize, MORTON_MAX_COORDINATE_2D)));
+}
+
+template <typename T>
+uint64_t Game::Math::Morton_Key3D(const Point3D<T>& point, const Point3D<T>& origin, const T cellSize)
+{
+    return Morton_Encode3D(Quantize(point.x, origin.x, cellSize, MORTON_MAX_COORDINATE_3D),
+                           Quantize(point.y, origin.y, cellSize, MORTON_MAX_COORDINATE_3D),
+                           Quantize(point.z, origin.z, cellSize, MORTON_MAX_COORDINATE_3D));
+}
+
+Game::Math::MortonSorter :: MortonSorter()
+{
+
+}
+
+void Game::Math::MortonSorter :: Sort(const uint32_t* keys, size_t count)
+{
+    RadixSort(keys, count, keys32[0], keys32[1]);
+}
+
+void Game::Math::MortonSorter :: Sort(const uint64_t* keys, size_t count)
+{
+    RadixSort(keys, count, keys64[0], keys64[1]);
+}
+
+template <typename Key>
+void Game::Math::MortonSorter :: RadixSort(const Key* keys, size_t count, DynamicArray<Key>& sortedKeys, DynamicArray<Key>& scratchKeys)
+{
+    permutation.resize(count);
+    scratch.resize(count);
+    sortedKeys.assign(keys, keys + count);
+    scratchKeys.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        permutation[i] = static_cast<uint32_t>(i);
+    }
+
+    for (size_t shift = 0; shift < sizeof(Key) * 8; shift += 8)
+    {
+        size_t histogram[256];
+        std::memset(histogram, 0, sizeof(histogram));
+        for (size_t i = 0; i < count; i++)
+        {
+            histogram[(sortedKeys[i] >> shift) & 0xFF]++;
+        }
+
+        // Every key has the same digit, the pass would not move anything
+        if (count == 0 || histogram[(sortedKeys[0] >> shift) & 0xFF] == count)
+        {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (size_t digit = 0; digit < 256; digit++)
+        {
+            size_t bucket = histogram[digit];
+            histogram[digit] = offset;
+            offset += bucket;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t destination = histogram[(sortedKeys[i] >> shift) & 0xFF]++;
+            scratchKeys[destination] = sortedKeys[i];
+            scratch[destination] = permutation[i];
+        }
+        sortedKeys.swap(scratchKeys);
+        permutation.swap(scratch);
+    }
+}
+
+const uint32_t* Game::Math::MortonSorter :: GetPermutation() const
+{
+    return permutation.data();
+}
+
+size_t Game::Math::MortonSorter :: GetCount() const
+{
+    return permutation.size();
+}
+
+template uint32_t Game::Math::Morton_Key2D(const Point2D<float>&, const Point2D<float>&, const float);
+template uint32_t Game::Math::Morton_Key2D(const Point2D<double>&, const Point2D<double>&, const double);
+template uint64_t Game::Math::Morton_Key3D(const Point3D<float>&, const Point3D<float>&, const float);
+template uint64_t Game::Math::Morton_Key3D(const Point3D<double>&, const Point3D<double>&, const double);
@@ -0,0 +1,106 @@
+/**
+ *  \file Narrowphase.cpp
+ *
+ *  \brief Source file for Narrowphase.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/Narrowphase.hpp"
+
+#include <algorithm>
+
+template <typename T>
+Game::Collision::Narrowphase<T> :: Narrowphase() : chunkSize(NARROWPHASE_DEFAULT_CHUNK_SIZE)
+{
+
+}
+
+template <typename T>
+Game::Collision::Narrowphase<T> :: Narrowphase(size_t p_chunkSize) : chunkSize(std::max<size_t>(p_chunkSize, 1))
+{
+
+}
+
+template <typename T>
+void Game::Collision::Narrowphase<T> :: Dispatch(const Collider<T>* colliders, const CandidatePair* pairs, size_t pairCount, ContactCache<T>& cache,
+                                                 Utils::ThreadPool& pool, Math::DynamicArray<NarrowphaseResult<T>>& results)
+{
+    results.clear();
+
+    // Pair records are created up front on this thread, workers only touch their own records
+    states.resize(pairCount);
+    for (size_t i = 0; i < pairCount; i++)
+    {
+        states[i] = &cache.Acquire(colliders[pairs[i].a].id, colliders[pairs[i].b].id);
+    }
+
+    size_t chunkCount = (pairCount + chunkSize - 1) / chunkSize;
+    if (chunkResults.size() < chunkCount)
+    {
+        chunkResults.resize(chunkCount);
+    }
+    chunkStats.assign(chunkCount, ContactCacheStats());
+
+    pool.ParallelFor(chunkCount, [&](size_t chunk, size_t)
+    {
+        Math::DynamicArray<NarrowphaseResult<T>>& output = chunkResults[chunk];
+        ContactCacheStats& stats = chunkStats[chunk];
+        output.clear();
+
+        size_t end = std::min(pairCount, (chunk + 1) * chunkSize);
+        for (size_t i = chunk * chunkSize; i < end; i++)
+        {
+            const Collider<T>& first = colliders[pairs[i].a];
+            const Collider<T>& second = colliders[pairs[i].b];
+            bool ordered = first.id < second.id;
+
+            ContactOutcome outcome = ordered ? ContactCache<T>::Update(*states[i], first.shape, second.shape)
+                                             : ContactCache<T>::Update(*states[i], second.shape, first.shape);
+
+            stats.queries++;
+            if (outcome == ContactOutcome::SeparatedByCachedAxis)
+            {
+                stats.separatingAxisEarlyOuts++;
+            }
+            else
+            {
+                stats.narrowphaseRuns++;
+            }
+
+            if (outcome == ContactOutcome::Touching)
+            {
+                output.push_back({ states[i]->idA, states[i]->idB, states[i]->manifold, first.isTrigger || second.isTrigger });
+            }
+        }
+    });
+
+    size_t total = 0;
+    for (size_t chunk = 0; chunk < chunkCount; chunk++)
+    {
+        total += chunkResults[chunk].size();
+        cache.Record(chunkStats[chunk]);
+    }
+
+    results.reserve(total);
+    for (size_t chunk = 0; chunk < chunkCount; chunk++)
+    {
+        results.insert(results.end(), chunkResults[chunk].begin(), chunkResults[chunk].end());
+    }
+}
+
+template <typename T>
+void Game::Collision::Narrowphase<T> :: SetChunkSize(size_t p_chunkSize)
+{
+    chunkSize = std::max<size_t>(p_chunkSize, 1);
+}
+
+template <typename T>
+size_t Game::Collision::Narrowphase<T> :: GetChunkSize() const
+{
+    return chunkSize;
+}
+
+template class Game::Collision::Narrowphase<float>;
+template class Game::Collision::Narrowphase<double>;
@@ -12,6 +12,7 @@
 #include "Math/Point2D.hpp"
 #include "Utils/Exceptions/Math_Exception.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 
@@ -76,10 +77,10 @@ Game::Math::Point2D<T> Game::Math::Point2D<T> :: Normalize() const
     if (std::abs(mag) < POINT2D_TOLERANCE_VALUE)
     {
         NormalizedPoint.x = NormalizedPoint.y = 0.0f;
+        return NormalizedPoint;
     }
     NormalizedPoint = Point2D<T>(x / mag, y / mag);
     
-    *this = NormalizedPoint;
     return NormalizedPoint;
 }
 
@@ -139,15 +140,15 @@ Game::Math::Point2D<T> Game::Math::Point2D<T> :: Round(const Game::Math::Point2D
     switch (flag)
     {
         case Game::Math::Point2D_Round_Flag::ToFloor:
-            RoundedPoint.SetVec((std::floor(x)), (std::floor(y)));
+            RoundedPoint.SetPoint((std::floor(x)), (std::floor(y)));
             break;
             
         case Game::Math::Point2D_Round_Flag::ToCeil:
-            RoundedPoint.SetVec((std::ceil(x)), (std::ceil(y)));
+            RoundedPoint.SetPoint((std::ceil(x)), (std::ceil(y)));
             break;
             
         case Game::Math::Point2D_Round_Flag::ToNearest:
-            RoundedPoint.SetVec((std::round(x)), (std::round(y)));
+            RoundedPoint.SetPoint((std::round(x)), (std::round(y)));
             break;
             
         default:
@@ -309,3 +310,6 @@ bool Game::Math::Point2D_IsNotEqual(const Game::Math::Point2D<T>& p1, const Game
 {
     return !(p1.x == p2.x && p1.y == p2.y);
 }
+
+template struct Game::Math::Point2D<float>;
+template struct Game::Math::Point2D<double>;
@@ -12,6 +12,7 @@
 #include "Math/Point3D.hpp"
 #include "Utils/Exceptions/Math_Exception.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 
@@ -55,7 +56,7 @@ double Game::Math::Point3D<T> :: DotProduct(const Game::Math::Point3D<T>& other)
 }
 
 template <typename T>
-double Game::Math::Point3D<T> :: CrossProduct(const Game::Math::Point3D<T>& other) const
+Game::Math::Point3D<T> Game::Math::Point3D<T> :: CrossProduct(const Game::Math::Point3D<T>& other) const
 {
     Point3D<T> result;
 
@@ -82,10 +83,10 @@ Game::Math::Point3D<T> Game::Math::Point3D<T> :: Normalize() const
     if (std::abs(mag) < POINT3D_TOLERANCE_VALUE)
     {
         NormalizedPoint.x = NormalizedPoint.y = NormalizedPoint.z = 0.0f;
+        return NormalizedPoint;
     }
     NormalizedPoint = Point3D<T>(x / mag, y / mag, z / mag);
     
-    *this = NormalizedPoint;
     return NormalizedPoint;
 }
 
@@ -152,15 +153,15 @@ Game::Math::Point3D<T> Game::Math::Point3D<T> :: Round(const Game::Math::Point3D
     switch (flag)
     {
         case Game::Math::Point3D_Round_Flag::ToFloor:
-            RoundedPoint.SetVec((std::floor(x)), (std::floor(y)), (std::floor(z)));
+            RoundedPoint.SetPoint((std::floor(x)), (std::floor(y)), (std::floor(z)));
             break;
             
         case Game::Math::Point3D_Round_Flag::ToCeil:
-            RoundedPoint.SetVec((std::ceil(x)), (std::ceil(y)), (std::ceil(z)));
+            RoundedPoint.SetPoint((std::ceil(x)), (std::ceil(y)), (std::ceil(z)));
             break;
             
         case Game::Math::Point3D_Round_Flag::ToNearest:
-            RoundedPoint.SetVec((std::round(x)), (std::round(y)), (std::round(z)));
+            RoundedPoint.SetPoint((std::round(x)), (std::round(y)), (std::round(z)));
             break;
             
         default:
@@ -201,7 +202,7 @@ double Game::Math::Point3D_DotProduct(const Game::Math::Point3D<T>& p1, const Ga
 }
 
 template <typename T>
-double Game::Math::Point3D_CrossProduct(const Game::Math::Point3D<T>& p1, const Game::Math::Point3D<T>& p2)
+Game::Math::Point3D<T> Game::Math::Point3D_CrossProduct(const Game::Math::Point3D<T>& p1, const Game::Math::Point3D<T>& p2)
 {
     Point3D<T> result;
 
@@ -338,3 +339,6 @@ bool Game::Math::Point3D_IsNotEqual(const Game::Math::Point3D<T>& p1, const Game
 {
     return !(p1.x == p2.x && p1.y == p2.y && p1.z == p2.z);
 }
+
+template struct Game::Math::Point3D<float>;
+template struct Game::Math::Point3D<double>;
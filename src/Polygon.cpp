@@ -0,0 +1,281 @@
+/**
+ *  \file Polygon.cpp
+ *
+ *  \brief Source file for Polygon.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Math/Polygon.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+using Game::Math::Vector2D;
+
+// Twice the signed area of the triangle (o, a, b), positive when b is left of o->a
+template <typename T>
+static T Cross(const Vector2D<T>& o, const Vector2D<T>& a, const Vector2D<T>& b)
+{
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+template <typename T>
+static bool IsSame(const Vector2D<T>& a, const Vector2D<T>& b)
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+template <typename T>
+size_t Game::Math::Polygon_ConvexHull(const Vector2D<T>* points, const size_t count, Vector2D<T>* hull, Utils::ScratchArena& arena)
+{
+    size_t marker = arena.GetMarker();
+    Vector2D<T>* sorted = arena.Allocate<Vector2D<T>>(count);
+    Vector2D<T>* chain = arena.Allocate<Vector2D<T>>(2 * count);
+    if (count > 0 && (sorted == nullptr || chain == nullptr))
+    {
+        std::cerr << "Polygon_ConvexHull: Scratch arena too small for " << count << " points" << std::endl;
+        arena.Release(marker);
+        return 0;
+    }
+
+    std::copy(points, points + count, sorted);
+    std::sort(sorted, sorted + count, [](const Vector2D<T>& a, const Vector2D<T>& b)
+    {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    });
+    size_t unique = std::unique(sorted, sorted + count, IsSame<T>) - sorted;
+    if (unique < 3)
+    {
+        std::copy(sorted, sorted + unique, hull);
+        arena.Release(marker);
+        return unique;
+    }
+
+    // Lower chain left to right, then upper chain right to left, popping every non left turn
+    size_t k = 0;
+    for (size_t i = 0; i < unique; i++)
+    {
+        while (k >= 2 && Cross(chain[k - 2], chain[k - 1], sorted[i]) <= 0)
+        {
+            k--;
+        }
+        chain[k++] = sorted[i];
+    }
+    for (size_t i = unique - 1, lower = k + 1; i-- > 0;)
+    {
+        while (k >= lower && Cross(chain[k - 2], chain[k - 1], sorted[i]) <= 0)
+        {
+            k--;
+        }
+        chain[k++] = sorted[i];
+    }
+
+    // The last point closes the loop back to the first
+    std::copy(chain, chain + k - 1, hull);
+    arena.Release(marker);
+    return k - 1;
+}
+
+template <typename T>
+T Game::Math::Polygon_SignedArea(const Vector2D<T>* vertices, const size_t count)
+{
+    T area = 0;
+    for (size_t i = 0, j = count - 1; i < count; j = i++)
+    {
+        area += vertices[j].x * vertices[i].y - vertices[i].x * vertices[j].y;
+    }
+    return area / 2;
+}
+
+template <typename T>
+Vector2D<T> Game::Math::Polygon_Centroid(const Vector2D<T>* vertices, const size_t count)
+{
+    if (count == 0)
+    {
+        return Vector2D<T>();
+    }
+
+    // Relative to the first vertex, which keeps far away polygons precise
+    const Vector2D<T>& origin = vertices[0];
+    T area = 0, x = 0, y = 0;
+    for (size_t i = 1; i + 1 < count; i++)
+    {
+        T ax = vertices[i].x - origin.x, ay = vertices[i].y - origin.y;
+        T bx = vertices[i + 1].x - origin.x, by = vertices[i + 1].y - origin.y;
+        T cross = ax * by - ay * bx;
+        area += cross;
+        x += (ax + bx) * cross;
+        y += (ay + by) * cross;
+    }
+
+    if (area == 0)
+    {
+        T sumX = 0, sumY = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            sumX += vertices[i].x;
+            sumY += vertices[i].y;
+        }
+        return Vector2D<T>(sumX / count, sumY / count);
+    }
+    return Vector2D<T>(origin.x + x / (3 * area), origin.y + y / (3 * area));
+}
+
+template <typename T>
+T Game::Math::Polygon_Inertia(const Vector2D<T>* vertices, const size_t count, const T mass)
+{
+    // Sum over the triangles fanned from the origin, the winding cancels out of the ratio
+    T area = 0, sum = 0;
+    for (size_t i = 0, j = count - 1; i < count; j = i++)
+    {
+        const Vector2D<T>& a = vertices[j];
+        const Vector2D<T>& b = vertices[i];
+        T cross = a.x * b.y - b.x * a.y;
+        area += cross;
+        sum += cross * (a.x * a.x + a.x * b.x + b.x * b.x + a.y * a.y + a.y * b.y + b.y * b.y);
+    }
+
+    if (area == 0)
+    {
+        return 0;
+    }
+    return mass * sum / (6 * area);
+}
+
+template <typename T>
+int Game::Math::Polygon_WindingNumber(const Vector2D<T>* vertices, const size_t count, const Vector2D<T>& point)
+{
+    // Upward crossings with the point on the left count +1, downward ones with it on the right -1
+    int winding = 0;
+    for (size_t i = 0, j = count - 1; i < count; j = i++)
+    {
+        const Vector2D<T>& a = vertices[j];
+        const Vector2D<T>& b = vertices[i];
+        if (a.y <= point.y)
+        {
+            if (b.y > point.y && Cross(a, b, point) > 0)
+            {
+                winding++;
+            }
+        }
+        else if (b.y <= point.y && Cross(a, b, point) < 0)
+        {
+            winding--;
+        }
+    }
+    return winding;
+}
+
+template <typename T>
+bool Game::Math::Polygon_ContainsPoint(const Vector2D<T>* vertices, const size_t count, const Vector2D<T>& point)
+{
+    return Polygon_WindingNumber(vertices, count, point) != 0;
+}
+
+template <typename T>
+size_t Game::Math::Polygon_Triangulate(const Vector2D<T>* vertices, const size_t count, uint32_t* triangles, Utils::ScratchArena& arena)
+{
+    if (count < 3)
+    {
+        return 0;
+    }
+
+    size_t marker = arena.GetMarker();
+    uint32_t* previous = arena.Allocate<uint32_t>(count);
+    uint32_t* next = arena.Allocate<uint32_t>(count);
+    if (previous == nullptr || next == nullptr)
+    {
+        std::cerr << "Polygon_Triangulate: Scratch arena too small for " << count << " vertices" << std::endl;
+        arena.Release(marker);
+        return 0;
+    }
+
+    // Walk clockwise input backwards so every ear is a left turn
+    bool reversed = Polygon_SignedArea(vertices, count) < 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        next[i] = static_cast<uint32_t>(reversed ? (i + count - 1) % count : (i + 1) % count);
+        previous[i] = static_cast<uint32_t>(reversed ? (i + 1) % count : (i + count - 1) % count);
+    }
+
+    auto isEar = [&](uint32_t index)
+    {
+        const Vector2D<T>& a = vertices[previous[index]];
+        const Vector2D<T>& b = vertices[index];
+        const Vector2D<T>& c = vertices[next[index]];
+        if (Cross(a, b, c) <= 0)
+        {
+            return false;
+        }
+
+        for (uint32_t other = next[next[index]]; other != previous[index]; other = next[other])
+        {
+            const Vector2D<T>& p = vertices[other];
+            if (IsSame(p, a) || IsSame(p, b) || IsSame(p, c))
+            {
+                continue;
+            }
+            if (Cross(a, b, p) >= 0 && Cross(b, c, p) >= 0 && Cross(c, a, p) >= 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    size_t remaining = count, triangleCount = 0, stalled = 0;
+    uint32_t current = 0;
+    while (remaining > 3 && stalled < remaining)
+    {
+        uint32_t following = next[current];
+        bool isCollinear = Cross(vertices[previous[current]], vertices[current], vertices[following]) == 0;
+        if (isCollinear || isEar(current))
+        {
+            // Collinear vertices are dropped without emitting a zero area triangle
+            if (!isCollinear)
+            {
+                triangles[3 * triangleCount + 0] = previous[current];
+                triangles[3 * triangleCount + 1] = current;
+                triangles[3 * triangleCount + 2] = following;
+                triangleCount++;
+            }
+            next[previous[current]] = following;
+            previous[following] = previous[current];
+            remaining--;
+            stalled = 0;
+        }
+        else
+        {
+            stalled++;
+        }
+        current = following;
+    }
+
+    if (remaining == 3 && Cross(vertices[previous[current]], vertices[current], vertices[next[current]]) > 0)
+    {
+        triangles[3 * triangleCount + 0] = previous[current];
+        triangles[3 * triangleCount + 1] = current;
+        triangles[3 * triangleCount + 2] = next[current];
+        triangleCount++;
+    }
+
+    arena.Release(marker);
+    return triangleCount;
+}
+
+template size_t Game::Math::Polygon_ConvexHull(const Vector2D<float>*, const size_t, Vector2D<float>*, Utils::ScratchArena&);
+template size_t Game::Math::Polygon_ConvexHull(const Vector2D<double>*, const size_t, Vector2D<double>*, Utils::ScratchArena&);
+template float Game::Math::Polygon_SignedArea(const Vector2D<float>*, const size_t);
+template double Game::Math::Polygon_SignedArea(const Vector2D<double>*, const size_t);
+template Vector2D<float> Game::Math::Polygon_Centroid(const Vector2D<float>*, const size_t);
+template Vector2D<double> Game::Math::Polygon_Centroid(const Vector2D<double>*, const size_t);
+template float Game::Math::Polygon_Inertia(const Vector2D<float>*, const size_t, const float);
+template double Game::Math::Polygon_Inertia(const Vector2D<double>*, const size_t, const double);
+template int Game::Math::Polygon_WindingNumber(const Vector2D<float>*, const size_t, const Vector2D<float>&);
+template int Game::Math::Polygon_WindingNumber(const Vector2D<double>*, const size_t, const Vector2D<double>&);
+template bool Game::Math::Polygon_ContainsPoint(const Vector2D<float>*, const size_t, const Vector2D<float>&);
+template bool Game::Math::Polygon_ContainsPoint(const Vector2D<double>*, const size_t, const Vector2D<double>&);
+template size_t Game::Math::Polygon_Triangulate(const Vector2D<float>*, const size_t, uint32_t*, Utils::ScratchArena&);
+template size_t Game::Math::Polygon_Triangulate(const Vector2D<double>*, const size_t, uint32_t*, Utils::ScratchArena&);
@@ -0,0 +1,358 @@
+/**
+ *  \file Quadtree.cpp
+ *
+ *  \brief Source file for Quadtree.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/Quadtree.hpp"
+#include "Collision/CCD.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <utility>
+
+using Game::Math::Vector2D;
+using Game::Collision::AABB;
+
+constexpr uint32_t DEPTH_BITS = 8;
+constexpr uint32_t DEPTH_MASK = (1u << DEPTH_BITS) - 1;
+static_assert(2 * Game::Collision::QUADTREE_MAX_DEPTH + DEPTH_BITS <= 32, "Quadtree keys must fit 32 bits");
+
+template <typename T>
+static T DistanceSquared(const AABB<T>& box, const Game::Math::Point2D<T>& point)
+{
+    T dx = std::max(std::max(box.min.x - point.x, point.x - box.max.x), T(0));
+    T dy = std::max(std::max(box.min.y - point.y, point.y - box.max.y), T(0));
+    return dx * dx + dy * dy;
+}
+
+template <typename T>
+Game::Collision::Quadtree<T> :: Quadtree()
+{
+
+}
+
+template <typename T>
+void Game::Collision::Quadtree<T> :: Build(const QuadtreeItem<T>* p_items, size_t count)
+{
+    Clear();
+    if (count == 0)
+    {
+        return;
+    }
+
+    bounds = p_items[0].bounds;
+    for (size_t i = 1; i < count; i++)
+    {
+        bounds = bounds.Merge(p_items[i].bounds);
+    }
+
+    // Square root node so every level splits evenly on both axes
+    T worldSize = std::max(bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y);
+    if (!(worldSize > 0))
+    {
+        worldSize = 1;
+    }
+
+    keys.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        const AABB<T>& itemBounds = p_items[i].bounds;
+        T size = std::max(itemBounds.max.x - itemBounds.min.x, itemBounds.max.y - itemBounds.min.y);
+
+        int depth = 0;
+        T cellSize = worldSize;
+        while (depth < QUADTREE_MAX_DEPTH && size <= cellSize / 2)
+        {
+            cellSize /= 2;
+            depth++;
+        }
+
+        Vector2D<T> center = itemBounds.Center();
+        T cellCount = static_cast<T>(1u << depth);
+        T cellX = std::min(std::max(std::floor((center.x - bounds.min.x) / cellSize), T(0)), cellCount - 1);
+        T cellY = std::min(std::max(std::floor((center.y - bounds.min.y) / cellSize), T(0)), cellCount - 1);
+
+        uint32_t code = Math::Morton_Encode2D(static_cast<uint16_t>(cellX), static_cast<uint16_t>(cellY));
+        code <<= 2 * (QUADTREE_MAX_DEPTH - depth);
+        keys[i] = (code << DEPTH_BITS) | static_cast<uint32_t>(depth);
+    }
+
+    // Morton order with parents before children, the radix sort is stable so ties keep input order
+    items.assign(p_items, p_items + count);
+    sorter.Sort(keys.data(), count);
+    sorter.Apply(items);
+    sorter.Apply(keys);
+
+    nodes.push_back(QuadtreeNode<T>());
+    BuildNode(0, 0, 0, static_cast<uint32_t>(count));
+}
+
+template <typename T>
+void Game::Collision::Quadtree<T> :: BuildNode(uint32_t nodeIndex, int depth, uint32_t begin, uint32_t end)
+{
+    uint32_t itemCount = 0;
+    while (begin + itemCount < end && static_cast<int>(keys[begin + itemCount] & DEPTH_MASK) == depth)
+    {
+        itemCount++;
+    }
+
+    QuadtreeNode<T>& node = nodes[nodeIndex];
+    node.firstChild = 0;
+    node.firstItem = begin;
+    node.itemCount = itemCount;
+    node.subtreeEnd = end;
+    if (begin == end)
+    {
+        return;
+    }
+
+    // Seeded with the first item of the subtree, which may belong to a child
+    AABB<T> nodeBounds = items[begin].bounds;
+    for (uint32_t i = begin + 1; i < begin + itemCount; i++)
+    {
+        nodeBounds = nodeBounds.Merge(items[i].bounds);
+    }
+
+    uint32_t rest = begin + itemCount;
+    if (rest < end)
+    {
+        // Children may be appended past capacity, so only indices are held across the recursion
+        uint32_t firstChild = static_cast<uint32_t>(nodes.size());
+        nodes.resize(nodes.size() + 4);
+
+        uint32_t shift = DEPTH_BITS + 2 * (QUADTREE_MAX_DEPTH - depth - 1);
+        for (uint32_t quadrant = 0; quadrant < 4; quadrant++)
+        {
+            uint32_t childEnd = rest;
+            while (childEnd < end && ((keys[childEnd] >> shift) & 3) == quadrant)
+            {
+                childEnd++;
+            }
+
+            BuildNode(firstChild + quadrant, depth + 1, rest, childEnd);
+            if (childEnd != rest)
+            {
+                nodeBounds = nodeBounds.Merge(nodes[firstChild + quadrant].bounds);
+            }
+            rest = childEnd;
+        }
+        nodes[nodeIndex].firstChild = firstChild;
+    }
+
+    nodes[nodeIndex].bounds = nodeBounds;
+}
+
+template <typename T>
+void Game::Collision::Quadtree<T> :: Clear()
+{
+    nodes.clear();
+    items.clear();
+    keys.clear();
+    bounds = AABB<T>();
+}
+
+template <typename T>
+void Game::Collision::Quadtree<T> :: QueryRegion(const AABB<T>& region, Math::DynamicArray<uint32_t>& results) const
+{
+    results.clear();
+    if (items.empty())
+    {
+        return;
+    }
+
+    uint32_t stack[4 * (QUADTREE_MAX_DEPTH + 1)];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const QuadtreeNode<T>& node = nodes[stack[--stackSize]];
+        if (node.firstItem == node.subtreeEnd || !region.Overlaps(node.bounds))
+        {
+            continue;
+        }
+
+        // Whole subtree inside the region, its items are contiguous
+        if (region.Contains(node.bounds))
+        {
+            for (uint32_t i = node.firstItem; i < node.subtreeEnd; i++)
+            {
+                results.push_back(items[i].id);
+            }
+            continue;
+        }
+
+        for (uint32_t i = node.firstItem; i < node.firstItem + node.itemCount; i++)
+        {
+            if (region.Overlaps(items[i].bounds))
+            {
+                results.push_back(items[i].id);
+            }
+        }
+
+        if (node.firstChild != 0)
+        {
+            for (uint32_t child = 0; child < 4; child++)
+            {
+                stack[stackSize++] = node.firstChild + child;
+            }
+        }
+    }
+}
+
+template <typename T>
+void Game::Collision::Quadtree<T> :: QueryPoint(const Math::Point2D<T>& point, Math::DynamicArray<uint32_t>& results) const
+{
+    Vector2D<T> position(point.x, point.y);
+    QueryRegion(AABB<T>(position, position), results);
+}
+
+template <typename T>
+void Game::Collision::Quadtree<T> :: QueryRay(const Math::Vector2D<T>& origin, const Math::Vector2D<T>& translation, Math::DynamicArray<uint32_t>& results) const
+{
+    results.clear();
+    if (items.empty())
+    {
+        return;
+    }
+
+    // The ray is a point box swept over the translation
+    const AABB<T> start(origin, origin);
+    uint32_t stack[4 * (QUADTREE_MAX_DEPTH + 1)];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const QuadtreeNode<T>& node = nodes[stack[--stackSize]];
+        if (node.firstItem == node.subtreeEnd || !CCD_SweptAABB(start, translation, node.bounds).hit)
+        {
+            continue;
+        }
+
+        for (uint32_t i = node.firstItem; i < node.firstItem + node.itemCount; i++)
+        {
+            if (CCD_SweptAABB(start, translation, items[i].bounds).hit)
+            {
+                results.push_back(items[i].id);
+            }
+        }
+
+        if (node.firstChild != 0)
+        {
+            for (uint32_t child = 0; child < 4; child++)
+            {
+                stack[stackSize++] = node.firstChild + child;
+            }
+        }
+    }
+}
+
+template <typename T>
+void Game::Collision::Quadtree<T> :: QueryNearest(const Math::Point2D<T>& point, size_t k, Math::DynamicArray<uint32_t>& results) const
+{
+    results.clear();
+    if (items.empty() || k == 0)
+    {
+        return;
+    }
+
+    using Candidate = std::pair<T, uint32_t>;
+
+    // Max heap of the k best items so far, min heap of nodes by distance to their bounds
+    Math::DynamicArray<Candidate> best;
+    Math::DynamicArray<Candidate> frontier;
+    best.reserve(k + 1);
+    frontier.push_back({ DistanceSquared(nodes[0].bounds, point), 0 });
+
+    while (!frontier.empty())
+    {
+        std::pop_heap(frontier.begin(), frontier.end(), std::greater<Candidate>());
+        Candidate next = frontier.back();
+        frontier.pop_back();
+        if (best.size() == k && next.first > best.front().first)
+        {
+            break;
+        }
+
+        const QuadtreeNode<T>& node = nodes[next.second];
+        for (uint32_t i = node.firstItem; i < node.firstItem + node.itemCount; i++)
+        {
+            Candidate item = { DistanceSquared(items[i].bounds, point), items[i].id };
+            if (best.size() < k)
+            {
+                best.push_back(item);
+                std::push_heap(best.begin(), best.end());
+            }
+            else if (item < best.front())
+            {
+                std::pop_heap(best.begin(), best.end());
+                best.back() = item;
+                std::push_heap(best.begin(), best.end());
+            }
+        }
+
+        if (node.firstChild == 0)
+        {
+            continue;
+        }
+        for (uint32_t child = node.firstChild; child < node.firstChild + 4; child++)
+        {
+            if (nodes[child].firstItem == nodes[child].subtreeEnd)
+            {
+                continue;
+            }
+
+            T distance = DistanceSquared(nodes[child].bounds, point);
+            if (best.size() < k || distance <= best.front().first)
+            {
+                frontier.push_back({ distance, child });
+                std::push_heap(frontier.begin(), frontier.end(), std::greater<Candidate>());
+            }
+        }
+    }
+
+    std::sort_heap(best.begin(), best.end());
+    for (const Candidate& item : best)
+    {
+        results.push_back(item.second);
+    }
+}
+
+template <typename T>
+size_t Game::Collision::Quadtree<T> :: GetItemCount() const
+{
+    return items.size();
+}
+
+template <typename T>
+size_t Game::Collision::Quadtree<T> :: GetNodeCount() const
+{
+    return nodes.size();
+}
+
+template <typename T>
+const Game::Collision::AABB<T>& Game::Collision::Quadtree<T> :: GetBounds() const
+{
+    return bounds;
+}
+
+template <typename T>
+const Game::Collision::QuadtreeItem<T>* Game::Collision::Quadtree<T> :: GetItems() const
+{
+    return items.data();
+}
+
+template <typename T>
+const Game::Collision::QuadtreeNode<T>* Game::Collision::Quadtree<T> :: GetNodes() const
+{
+    return nodes.data();
+}
+
+template class Game::Collision::Quadtree<float>;
+template class Game::Collision::Quadtree<double>;
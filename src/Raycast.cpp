@@ -0,0 +1,247 @@
+/**
+ *  \file Raycast.cpp
+ *
+ *  \brief Source file for Raycast.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/Raycast.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using Game::Math::Vector2D;
+
+template <typename T>
+static Vector2D<T> ToLocal(const Game::Collision::Shape<T>& shape, const Vector2D<T>& direction)
+{
+    const Vector2D<T>& r = shape.orientation;
+    return Vector2D<T>(direction.x * r.x + direction.y * r.y, -direction.x * r.y + direction.y * r.x);
+}
+
+template <typename T>
+static Vector2D<T> ToWorld(const Game::Collision::Shape<T>& shape, const Vector2D<T>& direction)
+{
+    const Vector2D<T>& r = shape.orientation;
+    return Vector2D<T>(direction.x * r.x - direction.y * r.y, direction.x * r.y + direction.y * r.x);
+}
+
+// Fraction and local normal of a ray entering a shape given in its local space
+template <typename T>
+struct LocalHit
+{
+    bool hit;
+    T fraction;
+    Vector2D<T> normal;
+};
+
+template <typename T>
+static LocalHit<T> Miss()
+{
+    return { false, 1, Vector2D<T>() };
+}
+
+template <typename T>
+static LocalHit<T> StartInside(const Vector2D<T>& translation)
+{
+    T length = std::sqrt(translation.x * translation.x + translation.y * translation.y);
+    if (length == 0)
+    {
+        return { true, 0, Vector2D<T>() };
+    }
+    return { true, 0, Vector2D<T>(-translation.x / length, -translation.y / length) };
+}
+
+template <typename T>
+static LocalHit<T> RaycastCircle(const Vector2D<T>& center, const T radius, const Vector2D<T>& origin, const Vector2D<T>& translation)
+{
+    T fx = origin.x - center.x, fy = origin.y - center.y;
+    T c = fx * fx + fy * fy - radius * radius;
+    if (c <= 0)
+    {
+        return StartInside(translation);
+    }
+
+    T a = translation.x * translation.x + translation.y * translation.y;
+    T b = fx * translation.x + fy * translation.y;
+    T discriminant = b * b - a * c;
+    if (a == 0 || b >= 0 || discriminant < 0)
+    {
+        return Miss<T>();
+    }
+
+    T fraction = (-b - std::sqrt(discriminant)) / a;
+    if (fraction > 1)
+    {
+        return Miss<T>();
+    }
+    return { true, fraction, Vector2D<T>((fx + translation.x * fraction) / radius, (fy + translation.y * fraction) / radius) };
+}
+
+template <typename T>
+static LocalHit<T> RaycastBox(const Vector2D<T>& halfExtents, const Vector2D<T>& origin, const Vector2D<T>& translation)
+{
+    T entry = 0, exit = 1;
+    int axis = -1;
+    const T start[2] = { origin.x, origin.y };
+    const T delta[2] = { translation.x, translation.y };
+    const T half[2] = { halfExtents.x, halfExtents.y };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (delta[i] == 0)
+        {
+            if (start[i] < -half[i] || start[i] > half[i])
+            {
+                return Miss<T>();
+            }
+            continue;
+        }
+
+        T first = (-half[i] - start[i]) / delta[i];
+        T second = (half[i] - start[i]) / delta[i];
+        if (first > second)
+        {
+            std::swap(first, second);
+        }
+        if (first > entry)
+        {
+            entry = first;
+            axis = i;
+        }
+        exit = std::min(exit, second);
+        if (entry > exit)
+        {
+            return Miss<T>();
+        }
+    }
+
+    if (axis < 0)
+    {
+        return StartInside(translation);
+    }
+
+    Vector2D<T> normal;
+    if (axis == 0)
+    {
+        normal.x = delta[0] > 0 ? -1 : 1;
+    }
+    else
+    {
+        normal.y = delta[1] > 0 ? -1 : 1;
+    }
+    return { true, entry, normal };
+}
+
+template <typename T>
+static LocalHit<T> RaycastPolygon(const Vector2D<T>* vertices, const size_t count, const Vector2D<T>& origin, const Vector2D<T>& translation)
+{
+    // Cyrus-Beck, clip the segment against every edge's half plane
+    T lower = 0, upper = 1;
+    Vector2D<T> normal;
+    bool entered = false;
+    for (size_t i = 0; i < count; i++)
+    {
+        const Vector2D<T>& a = vertices[i];
+        const Vector2D<T>& b = vertices[(i + 1) % count];
+        Vector2D<T> edgeNormal(b.y - a.y, a.x - b.x);
+        T numerator = edgeNormal.x * (a.x - origin.x) + edgeNormal.y * (a.y - origin.y);
+        T denominator = edgeNormal.x * translation.x + edgeNormal.y * translation.y;
+
+        if (denominator == 0)
+        {
+            if (numerator < 0)
+            {
+                return Miss<T>();
+            }
+            continue;
+        }
+
+        T fraction = numerator / denominator;
+        if (denominator < 0 && fraction > lower)
+        {
+            lower = fraction;
+            normal = edgeNormal;
+            entered = true;
+        }
+        else if (denominator > 0 && fraction < upper)
+        {
+            upper = fraction;
+        }
+        if (upper < lower)
+        {
+            return Miss<T>();
+        }
+    }
+
+    if (!entered)
+    {
+        return StartInside(translation);
+    }
+    T length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+    return { true, lower, Vector2D<T>(normal.x / length, normal.y / length) };
+}
+
+template <typename T>
+static LocalHit<T> RaycastCapsule(const T halfLength, const T radius, const Vector2D<T>& origin, const Vector2D<T>& translation)
+{
+    // The capsule is the union of its core box and end circles, the ray enters the union at the earliest entry
+    LocalHit<T> best = RaycastBox(Vector2D<T>(halfLength, radius), origin, translation);
+    const LocalHit<T> ends[2] =
+    {
+        RaycastCircle(Vector2D<T>(-halfLength, 0), radius, origin, translation),
+        RaycastCircle(Vector2D<T>(halfLength, 0), radius, origin, translation)
+    };
+    for (const LocalHit<T>& end : ends)
+    {
+        if (end.hit && (!best.hit || end.fraction < best.fraction))
+        {
+            best = end;
+        }
+    }
+    return best;
+}
+
+template <typename T>
+Game::Collision::RaycastHit<T> Game::Collision::Raycast_Shape(const Shape<T>& shape, const Math::Vector2D<T>& origin, const Math::Vector2D<T>& translation)
+{
+    LocalHit<T> local;
+    if (shape.type == ShapeType::Circle)
+    {
+        local = RaycastCircle(shape.position, shape.radius, origin, translation);
+    }
+    else
+    {
+        Vector2D<T> localOrigin = ToLocal(shape, origin - shape.position);
+        Vector2D<T> localTranslation = ToLocal(shape, translation);
+        switch (shape.type)
+        {
+        case ShapeType::Box:
+            local = RaycastBox(shape.halfExtents, localOrigin, localTranslation);
+            break;
+        case ShapeType::Capsule:
+            local = RaycastCapsule(shape.halfExtents.x, shape.radius, localOrigin, localTranslation);
+            break;
+        case ShapeType::Polygon:
+            local = RaycastPolygon(shape.vertices, shape.vertexCount, localOrigin, localTranslation);
+            break;
+        default:
+            local = Miss<T>();
+            break;
+        }
+        local.normal = ToWorld(shape, local.normal);
+    }
+
+    RaycastHit<T> result;
+    result.hit = local.hit;
+    result.id = 0;
+    result.fraction = local.fraction;
+    result.point = origin + translation * local.fraction;
+    result.normal = local.normal;
+    return result;
+}
+
+template Game::Collision::RaycastHit<float> Game::Collision::Raycast_Shape(const Shape<float>&, const Game::Math::Vector2D<float>&, const Game::Math::Vector2D<float>&);
+template Game::Collision::RaycastHit<double> Game::Collision::Raycast_Shape(const Shape<double>&, const Game::Math::Vector2D<double>&, const Game::Math::Vector2D<double>&);
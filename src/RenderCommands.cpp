@@ -0,0 +1,177 @@
+/**
+ *  \file RenderCommands.cpp
+ *
+ *  \brief Source file for RenderCommands.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Graphics/RenderCommands.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+static bool KeyLess(const Game::Graphics::RenderCommand& a, const Game::Graphics::RenderCommand& b)
+{
+    return a.key < b.key;
+}
+
+uint64_t Game::Graphics::RenderCommand_Key(int16_t layer, uint16_t texture, uint32_t depth)
+{
+    // Flipping the sign bit makes negative layers sort below positive ones
+    uint64_t biasedLayer = static_cast<uint16_t>(layer) ^ 0x8000u;
+    return (biasedLayer << 48) | (static_cast<uint64_t>(texture) << 32) | depth;
+}
+
+Game::Graphics::RenderCommandBuffer :: RenderCommandBuffer()
+{
+    commands.reserve(RENDER_COMMAND_RESERVE);
+}
+
+void Game::Graphics::RenderCommandBuffer :: Draw(uint16_t texture, const SDL_FRect& destination, const SDL_FRect& uv, int16_t layer, SDL_Color color, float angle, uint32_t depth)
+{
+    RenderCommand command;
+    command.key = RenderCommand_Key(layer, texture, depth);
+    command.destination = destination;
+    command.uv = uv;
+    command.angle = angle;
+    command.color = color;
+    command.texture = texture;
+    commands.push_back(command);
+}
+
+void Game::Graphics::RenderCommandBuffer :: FillRect(const SDL_FRect& rect, SDL_Color color, int16_t layer, uint32_t depth)
+{
+    Draw(RENDER_NO_TEXTURE, rect, SDL_FRect{ 0, 0, 0, 0 }, layer, color, 0, depth);
+}
+
+void Game::Graphics::RenderCommandBuffer :: Reset()
+{
+    commands.clear();
+}
+
+const Game::Graphics::RenderCommand* Game::Graphics::RenderCommandBuffer :: GetCommands() const
+{
+    return commands.data();
+}
+
+size_t Game::Graphics::RenderCommandBuffer :: GetCount() const
+{
+    return commands.size();
+}
+
+Game::Graphics::RenderQueue :: RenderQueue(size_t bufferCount) : buffers(std::max<size_t>(bufferCount, 1))
+{
+    textures.push_back(nullptr);
+}
+
+uint16_t Game::Graphics::RenderQueue :: RegisterTexture(SDL_Texture* texture)
+{
+    if (texture == nullptr)
+    {
+        return RENDER_NO_TEXTURE;
+    }
+
+    auto found = textureIds.find(texture);
+    if (found != textureIds.end())
+    {
+        return found->second;
+    }
+    if (textures.size() > 0xFFFF)
+    {
+        std::cerr << "RenderQueue: Texture table is full" << std::endl;
+        return RENDER_NO_TEXTURE;
+    }
+
+    uint16_t id = static_cast<uint16_t>(textures.size());
+    textures.push_back(texture);
+    textureIds.emplace(texture, id);
+    return id;
+}
+
+void Game::Graphics::RenderQueue :: ClearTextures()
+{
+    textures.resize(1);
+    textureIds.clear();
+}
+
+void Game::Graphics::RenderQueue :: BeginFrame()
+{
+    for (RenderCommandBuffer& buffer : buffers)
+    {
+        buffer.Reset();
+    }
+    sorted.clear();
+}
+
+Game::Graphics::RenderCommandBuffer* Game::Graphics::RenderQueue :: GetBuffer(size_t index)
+{
+    // Wrapping around would put two recording threads on one buffer
+    if (index >= buffers.size())
+    {
+        std::cerr << "RenderQueue: No buffer " << index << ", the queue was built with " << buffers.size() << std::endl;
+        return nullptr;
+    }
+    return &buffers[index];
+}
+
+void Game::Graphics::RenderQueue :: Sort(Utils::ThreadPool* pool)
+{
+    // Buffers are sorted independently, on the pool when there is one
+    auto sortBuffer = [this](size_t index, size_t)
+    {
+        Math::DynamicArray<RenderCommand>& commands = buffers[index].commands;
+        std::stable_sort(commands.begin(), commands.end(), KeyLess);
+    };
+    if (pool != nullptr && buffers.size() > 1)
+    {
+        pool->ParallelFor(buffers.size(), sortBuffer);
+    }
+    else
+    {
+        for (size_t i = 0; i < buffers.size(); i++)
+        {
+            sortBuffer(i, 0);
+        }
+    }
+
+    // Then merged in buffer order, std::merge takes from the earlier range on ties
+    sorted.clear();
+    for (const RenderCommandBuffer& buffer : buffers)
+    {
+        if (buffer.commands.empty())
+        {
+            continue;
+        }
+        scratch.resize(sorted.size() + buffer.commands.size());
+        std::merge(sorted.begin(), sorted.end(), buffer.commands.begin(), buffer.commands.end(), scratch.begin(), KeyLess);
+        sorted.swap(scratch);
+    }
+}
+
+size_t Game::Graphics::RenderQueue :: Replay(SpriteBatch& batch) const
+{
+    // Already in order, the batch only has to merge neighbours that share a texture
+    if (!batch.Begin(SpriteSortMode::Deferred))
+    {
+        return 0;
+    }
+    for (const RenderCommand& command : sorted)
+    {
+        SDL_Texture* texture = command.texture < textures.size() ? textures[command.texture] : nullptr;
+        batch.Draw(texture, command.destination, command.uv, 0, command.color, command.angle);
+    }
+    batch.End();
+    return sorted.size();
+}
+
+size_t Game::Graphics::RenderQueue :: GetBufferCount() const
+{
+    return buffers.size();
+}
+
+const Game::Math::DynamicArray<Game::Graphics::RenderCommand>& Game::Graphics::RenderQueue :: GetSortedCommands() const
+{
+    return sorted;
+}
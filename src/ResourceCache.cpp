@@ -0,0 +1,385 @@
+/**
+ *  \file ResourceCache.cpp
+ *
+ *  \brief Source file for ResourceCache.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Graphics/ResourceCache.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "SDL2/SDL_image.h"
+
+using Game::Graphics::ResourceMemory;
+using Game::Graphics::ResourceType;
+
+constexpr uint64_t RESOURCE_FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t RESOURCE_FNV_PRIME = 1099511628211ull;
+
+static uint64_t HashBytes(uint64_t hash, const void* data, size_t count)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < count; i++)
+    {
+        hash ^= bytes[i];
+        hash *= RESOURCE_FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint64_t ResourceKey(ResourceType type, const char* path, int fontSize)
+{
+    uint64_t hash = HashBytes(RESOURCE_FNV_OFFSET_BASIS, &type, sizeof(type));
+    hash = HashBytes(hash, &fontSize, sizeof(fontSize));
+    return HashBytes(hash, path, std::strlen(path));
+}
+
+static size_t MemoryIndex(ResourceType type)
+{
+    return static_cast<size_t>(type == ResourceType::Texture ? ResourceMemory::GPU : ResourceMemory::CPU);
+}
+
+Game::Graphics::ResourceCache :: ResourceCache(SDL_Renderer* p_renderer) : renderer(p_renderer), lruHead(RESOURCE_INVALID_INDEX), lruTail(RESOURCE_INVALID_INDEX),
+    budgets{ RESOURCE_DEFAULT_GPU_BUDGET, RESOURCE_DEFAULT_CPU_BUDGET }, usage{ 0, 0 }, stats()
+{
+
+}
+
+Game::Graphics::ResourceCache :: ~ResourceCache()
+{
+    for (uint32_t i = 0; i < entries.size(); i++)
+    {
+        if (entries[i].resource != nullptr)
+        {
+            Destroy(i);
+        }
+    }
+}
+
+Game::Graphics::ResourceHandle Game::Graphics::ResourceCache :: LoadTexture(const char* path)
+{
+    return Load(ResourceType::Texture, path, 0);
+}
+
+Game::Graphics::ResourceHandle Game::Graphics::ResourceCache :: LoadSurface(const char* path)
+{
+    return Load(ResourceType::Surface, path, 0);
+}
+
+Game::Graphics::ResourceHandle Game::Graphics::ResourceCache :: LoadFont(const char* path, int size)
+{
+    return Load(ResourceType::Font, path, size);
+}
+
+bool Game::Graphics::ResourceCache :: Acquire(ResourceHandle handle)
+{
+    if (!IsValid(handle))
+    {
+        return false;
+    }
+
+    ResourceEntry& entry = entries[handle.index];
+    if (entry.referenceCount++ == 0)
+    {
+        UnlinkLRU(handle.index);
+    }
+    return true;
+}
+
+bool Game::Graphics::ResourceCache :: Release(ResourceHandle handle)
+{
+    if (!IsValid(handle) || entries[handle.index].referenceCount == 0)
+    {
+        return false;
+    }
+
+    ResourceEntry& entry = entries[handle.index];
+    if (--entry.referenceCount == 0)
+    {
+        LinkLRU(handle.index);
+        Evict(static_cast<ResourceMemory>(MemoryIndex(entry.type)));
+    }
+    return true;
+}
+
+bool Game::Graphics::ResourceCache :: IsValid(ResourceHandle handle) const
+{
+    return handle.index < entries.size() && entries[handle.index].resource != nullptr && entries[handle.index].generation == handle.generation;
+}
+
+SDL_Texture* Game::Graphics::ResourceCache :: GetTexture(ResourceHandle handle) const
+{
+    const ResourceEntry* entry = Find(handle, ResourceType::Texture);
+    return entry != nullptr ? static_cast<SDL_Texture*>(entry->resource) : nullptr;
+}
+
+SDL_Surface* Game::Graphics::ResourceCache :: GetSurface(ResourceHandle handle) const
+{
+    const ResourceEntry* entry = Find(handle, ResourceType::Surface);
+    return entry != nullptr ? static_cast<SDL_Surface*>(entry->resource) : nullptr;
+}
+
+TTF_Font* Game::Graphics::ResourceCache :: GetFont(ResourceHandle handle) const
+{
+    const ResourceEntry* entry = Find(handle, ResourceType::Font);
+    return entry != nullptr ? static_cast<TTF_Font*>(entry->resource) : nullptr;
+}
+
+void Game::Graphics::ResourceCache :: SetBudget(ResourceMemory memory, size_t bytes)
+{
+    budgets[static_cast<size_t>(memory)] = bytes;
+    Evict(memory);
+}
+
+size_t Game::Graphics::ResourceCache :: GetBudget(ResourceMemory memory) const
+{
+    return budgets[static_cast<size_t>(memory)];
+}
+
+size_t Game::Graphics::ResourceCache :: GetMemoryUsage(ResourceMemory memory) const
+{
+    return usage[static_cast<size_t>(memory)];
+}
+
+void Game::Graphics::ResourceCache :: Trim()
+{
+    Evict(ResourceMemory::GPU);
+    Evict(ResourceMemory::CPU);
+}
+
+void Game::Graphics::ResourceCache :: EvictUnused()
+{
+    while (lruHead != RESOURCE_INVALID_INDEX)
+    {
+        Destroy(lruHead);
+        stats.evictionCount++;
+    }
+}
+
+const Game::Graphics::ResourceCacheStats& Game::Graphics::ResourceCache :: GetStats() const
+{
+    return stats;
+}
+
+void Game::Graphics::ResourceCache :: ResetStats()
+{
+    stats.hitCount = 0;
+    stats.missCount = 0;
+    stats.evictionCount = 0;
+    stats.failedCount = 0;
+}
+
+Game::Graphics::ResourceHandle Game::Graphics::ResourceCache :: Load(ResourceType type, const char* path, int fontSize)
+{
+    uint64_t key = ResourceKey(type, path, fontSize);
+    auto found = lookup.find(key);
+    if (found != lookup.end())
+    {
+        ResourceEntry& entry = entries[found->second];
+        if (entry.type != type || entry.fontSize != fontSize || entry.path != path)
+        {
+            std::cerr << "ResourceCache: Hash collision between " << entry.path << " and " << path << std::endl;
+            stats.failedCount++;
+            return ResourceHandle();
+        }
+
+        stats.hitCount++;
+        ResourceHandle handle = { found->second, entry.generation };
+        Acquire(handle);
+        return handle;
+    }
+
+    stats.missCount++;
+    size_t bytes = 0;
+    void* resource = Create(type, path, fontSize, bytes);
+    if (resource == nullptr)
+    {
+        stats.failedCount++;
+        return ResourceHandle();
+    }
+
+    uint32_t index;
+    if (!freeEntries.empty())
+    {
+        index = freeEntries.back();
+        freeEntries.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(entries.size());
+        entries.push_back(ResourceEntry());
+        entries.back().generation = 0;
+    }
+
+    ResourceEntry& entry = entries[index];
+    entry.resource = resource;
+    entry.path = path;
+    entry.key = key;
+    entry.bytes = bytes;
+    entry.referenceCount = 1;
+    entry.previous = entry.next = RESOURCE_INVALID_INDEX;
+    entry.type = type;
+    entry.fontSize = fontSize;
+    lookup.emplace(key, index);
+
+    size_t memory = MemoryIndex(type);
+    usage[memory] += bytes;
+    stats.residentCount++;
+    stats.gpuBytes = usage[0];
+    stats.cpuBytes = usage[1];
+
+    // The new resource is referenced, older unreferenced ones make room for it
+    Evict(static_cast<ResourceMemory>(memory));
+    return ResourceHandle{ index, entry.generation };
+}
+
+void* Game::Graphics::ResourceCache :: Create(ResourceType type, const char* path, int fontSize, size_t& bytes) const
+{
+    switch (type)
+    {
+        case ResourceType::Texture:
+        {
+            SDL_Texture* texture = IMG_LoadTexture(renderer, path);
+            int w = 0, h = 0;
+            if (texture == nullptr || SDL_QueryTexture(texture, nullptr, nullptr, &w, &h) != 0)
+            {
+                std::cerr << "ResourceCache: Can't load texture " << path << ": " << IMG_GetError() << std::endl;
+                if (texture != nullptr)
+                {
+                    SDL_DestroyTexture(texture);
+                }
+                return nullptr;
+            }
+            bytes = static_cast<size_t>(w) * h * 4;
+            return texture;
+        }
+        case ResourceType::Surface:
+        {
+            SDL_Surface* surface = IMG_Load(path);
+            if (surface == nullptr)
+            {
+                std::cerr << "ResourceCache: Can't load surface " << path << ": " << IMG_GetError() << std::endl;
+                return nullptr;
+            }
+            bytes = static_cast<size_t>(surface->pitch) * surface->h;
+            return surface;
+        }
+        case ResourceType::Font:
+        {
+            TTF_Font* font = TTF_OpenFont(path, fontSize);
+            if (font == nullptr)
+            {
+                std::cerr << "ResourceCache: Can't load font " << path << ": " << TTF_GetError() << std::endl;
+                return nullptr;
+            }
+
+            // SDL_ttf keeps no size of its own, the file size is a fair stand in
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            bytes = file ? static_cast<size_t>(file.tellg()) : 0;
+            return font;
+        }
+    }
+    return nullptr;
+}
+
+void Game::Graphics::ResourceCache :: Destroy(uint32_t index)
+{
+    ResourceEntry& entry = entries[index];
+    if (entry.referenceCount == 0)
+    {
+        UnlinkLRU(index);
+    }
+
+    switch (entry.type)
+    {
+        case ResourceType::Texture:
+            SDL_DestroyTexture(static_cast<SDL_Texture*>(entry.resource));
+            break;
+        case ResourceType::Surface:
+            SDL_FreeSurface(static_cast<SDL_Surface*>(entry.resource));
+            break;
+        case ResourceType::Font:
+            TTF_CloseFont(static_cast<TTF_Font*>(entry.resource));
+            break;
+    }
+
+    usage[MemoryIndex(entry.type)] -= entry.bytes;
+    lookup.erase(entry.key);
+    entry.resource = nullptr;
+    entry.path.clear();
+    entry.referenceCount = 0;
+    entry.generation++;
+    freeEntries.push_back(index);
+
+    stats.residentCount--;
+    stats.gpuBytes = usage[0];
+    stats.cpuBytes = usage[1];
+}
+
+const Game::Graphics::ResourceCache::ResourceEntry* Game::Graphics::ResourceCache :: Find(ResourceHandle handle, ResourceType type) const
+{
+    if (!IsValid(handle) || entries[handle.index].type != type)
+    {
+        return nullptr;
+    }
+    return &entries[handle.index];
+}
+
+void Game::Graphics::ResourceCache :: LinkLRU(uint32_t index)
+{
+    ResourceEntry& entry = entries[index];
+    entry.previous = lruTail;
+    entry.next = RESOURCE_INVALID_INDEX;
+    if (lruTail != RESOURCE_INVALID_INDEX)
+    {
+        entries[lruTail].next = index;
+    }
+    else
+    {
+        lruHead = index;
+    }
+    lruTail = index;
+}
+
+void Game::Graphics::ResourceCache :: UnlinkLRU(uint32_t index)
+{
+    ResourceEntry& entry = entries[index];
+    if (entry.previous != RESOURCE_INVALID_INDEX)
+    {
+        entries[entry.previous].next = entry.next;
+    }
+    else
+    {
+        lruHead = entry.next;
+    }
+    if (entry.next != RESOURCE_INVALID_INDEX)
+    {
+        entries[entry.next].previous = entry.previous;
+    }
+    else
+    {
+        lruTail = entry.previous;
+    }
+    entry.previous = entry.next = RESOURCE_INVALID_INDEX;
+}
+
+void Game::Graphics::ResourceCache :: Evict(ResourceMemory memory)
+{
+    size_t pool = static_cast<size_t>(memory);
+    uint32_t index = lruHead;
+    while (usage[pool] > budgets[pool] && index != RESOURCE_INVALID_INDEX)
+    {
+        uint32_t next = entries[index].next;
+        if (MemoryIndex(entries[index].type) == pool)
+        {
+            Destroy(index);
+            stats.evictionCount++;
+        }
+        index = next;
+    }
+}
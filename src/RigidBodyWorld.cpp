@@ -0,0 +1,902 @@
+/**
+ *  \file RigidBodyWorld.cpp
+ *
+ *  \brief Source file for RigidBodyWorld.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Physics/RigidBodyWorld.hpp"
+#include "Math/Polygon.hpp"
+#include "Math/Math_Utils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using Game::Math::Vector2D;
+
+template <typename T>
+static T Cross(const Vector2D<T>& a, const Vector2D<T>& b)
+{
+    return a.x * b.y - a.y * b.x;
+}
+
+template <typename T>
+static Vector2D<T> Cross(const T w, const Vector2D<T>& r)
+{
+    return Vector2D<T>(-w * r.y, w * r.x);
+}
+
+template <typename T>
+static void SwapRemove(Game::Math::DynamicArray<T>& lane, size_t index)
+{
+    lane[index] = lane.back();
+    lane.pop_back();
+}
+
+template <typename T>
+static T ComputeInertia(const Game::Collision::Shape<T>& shape, const T mass)
+{
+    using Game::Collision::ShapeType;
+
+    switch (shape.type)
+    {
+    case ShapeType::Circle:
+        return mass * shape.radius * shape.radius / 2;
+    case ShapeType::Box:
+        return mass * (shape.halfExtents.x * shape.halfExtents.x + shape.halfExtents.y * shape.halfExtents.y) / 3;
+    case ShapeType::Capsule:
+    {
+        // Box around the segment, close enough for the solver
+        T halfWidth = shape.halfExtents.x + shape.radius;
+        return mass * (halfWidth * halfWidth + shape.radius * shape.radius) / 3;
+    }
+    case ShapeType::Polygon:
+        return Game::Math::Polygon_Inertia(shape.vertices, shape.vertexCount, mass);
+    }
+    return mass;
+}
+
+static uint32_t FindRoot(Game::Math::DynamicArray<uint32_t>& parents, uint32_t index)
+{
+    while (parents[index] != index)
+    {
+        parents[index] = parents[parents[index]];
+        index = parents[index];
+    }
+    return index;
+}
+
+template <typename T>
+Game::Physics::RigidBodyWorld<T> :: RigidBodyWorld() : gravity(0, static_cast<T>(9.81)), timeStep(static_cast<T>(PHYSICS_DEFAULT_TIME_STEP)),
+    velocityIterations(PHYSICS_DEFAULT_VELOCITY_ITERATIONS), sleepingEnabled(true), deterministic(false), stats()
+{
+
+}
+
+template <typename T>
+Game::Physics::RigidBodyWorld<T> :: RigidBodyWorld(size_t workerCount) : collisionWorld(workerCount), gravity(0, static_cast<T>(9.81)),
+    timeStep(static_cast<T>(PHYSICS_DEFAULT_TIME_STEP)), velocityIterations(PHYSICS_DEFAULT_VELOCITY_ITERATIONS), sleepingEnabled(true), deterministic(false), stats()
+{
+
+}
+
+template <typename T>
+uint32_t Game::Physics::RigidBodyWorld<T> :: AddBody(const Collision::Shape<T>& shape, const T mass)
+{
+    // Body ids are collider ids, contacts map straight back to bodies
+    bool isStatic = mass <= 0;
+    uint32_t id = isStatic ? collisionWorld.AddStaticCollider(shape) : collisionWorld.AddCollider(shape);
+
+    indices[id] = ids.size();
+    ids.push_back(id);
+    positions.push_back(shape.position);
+    velocities.push_back(Vector2D<T>());
+    forces.push_back(Vector2D<T>());
+    angles.push_back(shape.rotation);
+    angularVelocities.push_back(0);
+    torques.push_back(0);
+    inverseMasses.push_back(isStatic ? 0 : 1 / mass);
+    T inertia = isStatic ? 0 : ComputeInertia(shape, mass);
+    inverseInertias.push_back(inertia > 0 ? 1 / inertia : 0);
+    frictions.push_back(static_cast<T>(0.6));
+    restitutions.push_back(0);
+    sleepTimes.push_back(0);
+    awake.push_back(!isStatic);
+    return id;
+}
+
+template <typename T>
+bool Game::Physics::RigidBodyWorld<T> :: RemoveBody(uint32_t id)
+{
+    auto found = indices.find(id);
+    if (found == indices.end())
+    {
+        return false;
+    }
+
+    // Sleeping neighbours would otherwise keep resting on a body that is gone
+    const Collision::Collider<T>* removed = collisionWorld.GetCollider(id);
+    if (removed != nullptr)
+    {
+        const Collision::Collider<T>* colliders = collisionWorld.GetColliders();
+        for (size_t i = 0; i < collisionWorld.GetColliderCount(); i++)
+        {
+            if (colliders[i].id == id || !colliders[i].bounds.Overlaps(removed->bounds))
+            {
+                continue;
+            }
+
+            // Colliders added straight to the collision world have no body
+            auto neighbour = indices.find(colliders[i].id);
+            if (neighbour != indices.end())
+            {
+                WakeBody(neighbour->second);
+            }
+        }
+    }
+
+    size_t index = found->second;
+    indices.erase(found);
+    if (index + 1 != ids.size())
+    {
+        indices[ids.back()] = index;
+    }
+
+    SwapRemove(ids, index);
+    SwapRemove(positions, index);
+    SwapRemove(velocities, index);
+    SwapRemove(forces, index);
+    SwapRemove(angles, index);
+    SwapRemove(angularVelocities, index);
+    SwapRemove(torques, index);
+    SwapRemove(inverseMasses, index);
+    SwapRemove(inverseInertias, index);
+    SwapRemove(frictions, index);
+    SwapRemove(restitutions, index);
+    SwapRemove(sleepTimes, index);
+    SwapRemove(awake, index);
+
+    collisionWorld.RemoveCollider(id);
+    return true;
+}
+
+template <typename T>
+bool Game::Physics::RigidBodyWorld<T> :: HasBody(uint32_t id) const
+{
+    return indices.find(id) != indices.end();
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetPosition(uint32_t id, const Math::Vector2D<T>& position)
+{
+    auto found = indices.find(id);
+    if (found == indices.end())
+    {
+        return;
+    }
+
+    positions[found->second] = position;
+    collisionWorld.SetTransform(id, position, angles[found->second]);
+    WakeBody(found->second);
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetAngle(uint32_t id, const T angle)
+{
+    auto found = indices.find(id);
+    if (found == indices.end())
+    {
+        return;
+    }
+
+    angles[found->second] = angle;
+    collisionWorld.SetTransform(id, positions[found->second], angle);
+    WakeBody(found->second);
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetVelocity(uint32_t id, const Math::Vector2D<T>& velocity)
+{
+    auto found = indices.find(id);
+    if (found != indices.end() && inverseMasses[found->second] > 0)
+    {
+        velocities[found->second] = velocity;
+        WakeBody(found->second);
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetAngularVelocity(uint32_t id, const T angularVelocity)
+{
+    auto found = indices.find(id);
+    if (found != indices.end() && inverseMasses[found->second] > 0)
+    {
+        angularVelocities[found->second] = angularVelocity;
+        WakeBody(found->second);
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetFriction(uint32_t id, const T friction)
+{
+    auto found = indices.find(id);
+    if (found != indices.end())
+    {
+        frictions[found->second] = friction;
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetRestitution(uint32_t id, const T restitution)
+{
+    auto found = indices.find(id);
+    if (found != indices.end())
+    {
+        restitutions[found->second] = restitution;
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetAwake(uint32_t id, bool p_awake)
+{
+    auto found = indices.find(id);
+    if (found == indices.end())
+    {
+        return;
+    }
+
+    if (p_awake)
+    {
+        WakeBody(found->second);
+    }
+    else
+    {
+        SleepBody(found->second);
+    }
+}
+
+template <typename T>
+Game::Math::Vector2D<T> Game::Physics::RigidBodyWorld<T> :: GetPosition(uint32_t id) const
+{
+    auto found = indices.find(id);
+    return found == indices.end() ? Vector2D<T>() : positions[found->second];
+}
+
+template <typename T>
+T Game::Physics::RigidBodyWorld<T> :: GetAngle(uint32_t id) const
+{
+    auto found = indices.find(id);
+    return found == indices.end() ? 0 : angles[found->second];
+}
+
+template <typename T>
+Game::Math::Vector2D<T> Game::Physics::RigidBodyWorld<T> :: GetVelocity(uint32_t id) const
+{
+    auto found = indices.find(id);
+    return found == indices.end() ? Vector2D<T>() : velocities[found->second];
+}
+
+template <typename T>
+T Game::Physics::RigidBodyWorld<T> :: GetAngularVelocity(uint32_t id) const
+{
+    auto found = indices.find(id);
+    return found == indices.end() ? 0 : angularVelocities[found->second];
+}
+
+template <typename T>
+bool Game::Physics::RigidBodyWorld<T> :: IsAwake(uint32_t id) const
+{
+    auto found = indices.find(id);
+    return found != indices.end() && awake[found->second];
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: ApplyForce(uint32_t id, const Math::Vector2D<T>& force)
+{
+    auto found = indices.find(id);
+    if (found != indices.end() && inverseMasses[found->second] > 0)
+    {
+        forces[found->second] = forces[found->second] + force;
+        WakeBody(found->second);
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: ApplyTorque(uint32_t id, const T torque)
+{
+    auto found = indices.find(id);
+    if (found != indices.end() && inverseMasses[found->second] > 0)
+    {
+        torques[found->second] += torque;
+        WakeBody(found->second);
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: ApplyImpulse(uint32_t id, const Math::Vector2D<T>& impulse, const Math::Vector2D<T>& point)
+{
+    auto found = indices.find(id);
+    if (found == indices.end() || inverseMasses[found->second] <= 0)
+    {
+        return;
+    }
+
+    size_t index = found->second;
+    velocities[index] = velocities[index] + impulse * inverseMasses[index];
+    angularVelocities[index] += inverseInertias[index] * Cross(point - positions[index], impulse);
+    WakeBody(index);
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: Step()
+{
+    auto start = std::chrono::steady_clock::now();
+    const T dt = timeStep;
+
+    collisionWorld.Update();
+    BuildConstraints();
+
+    // Semi-implicit Euler, velocities first
+    size_t bodyCount = ids.size();
+    for (size_t i = 0; i < bodyCount; i++)
+    {
+        if (!awake[i])
+        {
+            continue;
+        }
+
+        velocities[i].x += (gravity.x + forces[i].x * inverseMasses[i]) * dt;
+        velocities[i].y += (gravity.y + forces[i].y * inverseMasses[i]) * dt;
+        angularVelocities[i] += torques[i] * inverseInertias[i] * dt;
+    }
+
+    SolveVelocities();
+
+    // Then positions with the solved velocities
+    size_t awakeCount = 0;
+    for (size_t i = 0; i < bodyCount; i++)
+    {
+        forces[i] = Vector2D<T>();
+        torques[i] = 0;
+        if (!awake[i])
+        {
+            continue;
+        }
+
+        awakeCount++;
+        positions[i].x += velocities[i].x * dt;
+        positions[i].y += velocities[i].y * dt;
+        angles[i] += angularVelocities[i] * dt;
+        collisionWorld.SetTransform(ids[i], positions[i], angles[i]);
+    }
+
+    UpdateSleep();
+
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    stats.stepCount++;
+    stats.bodySteps += bodyCount;
+    stats.awakeBodyCount = awakeCount;
+    stats.constraintCount = constraints.size();
+    stats.lastStepMilliseconds = milliseconds;
+    stats.totalMilliseconds += milliseconds;
+    if (deterministic)
+    {
+        stats.stateHash = ComputeStateHash();
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SortBodies()
+{
+    size_t bodyCount = ids.size();
+    if (bodyCount < 2)
+    {
+        return;
+    }
+
+    Vector2D<T> minimum = positions[0], maximum = positions[0];
+    for (const Vector2D<T>& position : positions)
+    {
+        minimum = Vector2D<T>(std::min(minimum.x, position.x), std::min(minimum.y, position.y));
+        maximum = Vector2D<T>(std::max(maximum.x, position.x), std::max(maximum.y, position.y));
+    }
+
+    T extent = std::max(maximum.x - minimum.x, maximum.y - minimum.y);
+    T cellSize = extent > 0 ? extent / static_cast<T>(Math::MORTON_MAX_COORDINATE_2D) : 1;
+    Math::Point2D<T> origin(minimum.x, minimum.y);
+
+    sortKeys.resize(bodyCount);
+    for (size_t i = 0; i < bodyCount; i++)
+    {
+        sortKeys[i] = Math::Morton_Key2D(Math::Point2D<T>(positions[i].x, positions[i].y), origin, cellSize);
+    }
+
+    sorter.Sort(sortKeys.data(), bodyCount);
+    sorter.Apply(ids);
+    sorter.Apply(positions);
+    sorter.Apply(velocities);
+    sorter.Apply(forces);
+    sorter.Apply(angles);
+    sorter.Apply(angularVelocities);
+    sorter.Apply(torques);
+    sorter.Apply(inverseMasses);
+    sorter.Apply(inverseInertias);
+    sorter.Apply(frictions);
+    sorter.Apply(restitutions);
+    sorter.Apply(sleepTimes);
+    sorter.Apply(awake);
+
+    for (size_t i = 0; i < bodyCount; i++)
+    {
+        indices[ids[i]] = i;
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: WakeBody(size_t index)
+{
+    sleepTimes[index] = 0;
+    if (awake[index] || inverseMasses[index] <= 0)
+    {
+        return;
+    }
+
+    awake[index] = true;
+    collisionWorld.SetResting(ids[index], false);
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SleepBody(size_t index)
+{
+    if (!awake[index])
+    {
+        return;
+    }
+
+    awake[index] = false;
+    velocities[index] = Vector2D<T>();
+    angularVelocities[index] = 0;
+    collisionWorld.SetResting(ids[index], true);
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: BuildConstraints()
+{
+    const T inverseTimeStep = 1 / timeStep;
+    const T baumgarte = static_cast<T>(PHYSICS_BAUMGARTE);
+    const T slop = static_cast<T>(PHYSICS_LINEAR_SLOP);
+    const T restitutionThreshold = static_cast<T>(PHYSICS_RESTITUTION_THRESHOLD);
+
+    constraints.clear();
+    for (const Collision::NarrowphaseResult<T>& contact : collisionWorld.GetContacts())
+    {
+        auto foundA = indices.find(contact.idA);
+        auto foundB = indices.find(contact.idB);
+        if (foundA == indices.end() || foundB == indices.end())
+        {
+            continue;
+        }
+
+        uint32_t indexA = static_cast<uint32_t>(foundA->second);
+        uint32_t indexB = static_cast<uint32_t>(foundB->second);
+        if (inverseMasses[indexA] <= 0 && inverseMasses[indexB] <= 0)
+        {
+            continue;
+        }
+
+        // A moving body touching a sleeping one wakes it before the solve
+        if (!awake[indexA] && !awake[indexB])
+        {
+            continue;
+        }
+        if (!awake[indexA] && inverseMasses[indexA] > 0)
+        {
+            WakeBody(indexA);
+        }
+        if (!awake[indexB] && inverseMasses[indexB] > 0)
+        {
+            WakeBody(indexB);
+        }
+
+        const Collision::ContactManifold<T>& manifold = contact.manifold;
+        ContactConstraint<T> constraint;
+        constraint.indexA = indexA;
+        constraint.indexB = indexB;
+        constraint.normal = manifold.normal;
+        constraint.pointCount = manifold.pointCount;
+        constraint.friction = std::sqrt(frictions[indexA] * frictions[indexB]);
+        constraint.restitution = std::max(restitutions[indexA], restitutions[indexB]);
+        constraint.pair = collisionWorld.GetContactCache().Find(contact.idA, contact.idB);
+
+        const T massA = inverseMasses[indexA], massB = inverseMasses[indexB];
+        const T inertiaA = inverseInertias[indexA], inertiaB = inverseInertias[indexB];
+        const Vector2D<T> normal = manifold.normal;
+        const Vector2D<T> tangent(normal.y, -normal.x);
+
+        for (int i = 0; i < manifold.pointCount; i++)
+        {
+            const Collision::ContactPoint<T>& source = manifold.points[i];
+            ContactConstraintPoint<T>& point = constraint.points[i];
+            point.rA = source.position - positions[indexA];
+            point.rB = source.position - positions[indexB];
+            point.normalImpulse = source.normalImpulse;
+            point.tangentImpulse = source.tangentImpulse;
+
+            T rnA = Cross(point.rA, normal), rnB = Cross(point.rB, normal);
+            T rtA = Cross(point.rA, tangent), rtB = Cross(point.rB, tangent);
+            point.normalMass = 1 / (massA + massB + inertiaA * rnA * rnA + inertiaB * rnB * rnB);
+            point.tangentMass = 1 / (massA + massB + inertiaA * rtA * rtA + inertiaB * rtB * rtB);
+
+            Vector2D<T> relative = velocities[indexB] + Cross(angularVelocities[indexB], point.rB) -
+                                   velocities[indexA] - Cross(angularVelocities[indexA], point.rA);
+            T normalVelocity = static_cast<T>(relative.DotProduct(normal));
+            point.bias = baumgarte * inverseTimeStep * std::max<T>(source.depth - slop, 0);
+            if (normalVelocity < -restitutionThreshold)
+            {
+                point.bias = std::max(point.bias, -constraint.restitution * normalVelocity);
+            }
+        }
+
+        constraints.push_back(constraint);
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SolveVelocities()
+{
+    // Warm start with last step's accumulated impulses
+    for (const ContactConstraint<T>& constraint : constraints)
+    {
+        const size_t a = constraint.indexA, b = constraint.indexB;
+        const Vector2D<T> tangent(constraint.normal.y, -constraint.normal.x);
+        for (int i = 0; i < constraint.pointCount; i++)
+        {
+            const ContactConstraintPoint<T>& point = constraint.points[i];
+            Vector2D<T> impulse = constraint.normal * point.normalImpulse + tangent * point.tangentImpulse;
+            velocities[a] = velocities[a] - impulse * inverseMasses[a];
+            angularVelocities[a] -= inverseInertias[a] * Cross(point.rA, impulse);
+            velocities[b] = velocities[b] + impulse * inverseMasses[b];
+            angularVelocities[b] += inverseInertias[b] * Cross(point.rB, impulse);
+        }
+    }
+
+    for (int iteration = 0; iteration < velocityIterations; iteration++)
+    {
+        for (ContactConstraint<T>& constraint : constraints)
+        {
+            const size_t a = constraint.indexA, b = constraint.indexB;
+            const T massA = inverseMasses[a], massB = inverseMasses[b];
+            const T inertiaA = inverseInertias[a], inertiaB = inverseInertias[b];
+            const Vector2D<T> normal = constraint.normal;
+            const Vector2D<T> tangent(normal.y, -normal.x);
+
+            for (int i = 0; i < constraint.pointCount; i++)
+            {
+                ContactConstraintPoint<T>& point = constraint.points[i];
+
+                // Friction first, bounded by the current normal impulse
+                Vector2D<T> relative = velocities[b] + Cross(angularVelocities[b], point.rB) - velocities[a] - Cross(angularVelocities[a], point.rA);
+                T lambda = -point.tangentMass * static_cast<T>(relative.DotProduct(tangent));
+                T maxFriction = constraint.friction * point.normalImpulse;
+                T accumulated = std::max(-maxFriction, std::min(point.tangentImpulse + lambda, maxFriction));
+                lambda = accumulated - point.tangentImpulse;
+                point.tangentImpulse = accumulated;
+
+                Vector2D<T> impulse = tangent * lambda;
+                velocities[a] = velocities[a] - impulse * massA;
+                angularVelocities[a] -= inertiaA * Cross(point.rA, impulse);
+                velocities[b] = velocities[b] + impulse * massB;
+                angularVelocities[b] += inertiaB * Cross(point.rB, impulse);
+
+                // Normal, accumulated impulse is clamped instead of each increment
+                relative = velocities[b] + Cross(angularVelocities[b], point.rB) - velocities[a] - Cross(angularVelocities[a], point.rA);
+                lambda = point.normalMass * (point.bias - static_cast<T>(relative.DotProduct(normal)));
+                accumulated = std::max<T>(point.normalImpulse + lambda, 0);
+                lambda = accumulated - point.normalImpulse;
+                point.normalImpulse = accumulated;
+
+                impulse = normal * lambda;
+                velocities[a] = velocities[a] - impulse * massA;
+                angularVelocities[a] -= inertiaA * Cross(point.rA, impulse);
+                velocities[b] = velocities[b] + impulse * massB;
+                angularVelocities[b] += inertiaB * Cross(point.rB, impulse);
+            }
+        }
+    }
+
+    for (const ContactConstraint<T>& constraint : constraints)
+    {
+        if (constraint.pair == nullptr)
+        {
+            continue;
+        }
+
+        for (int i = 0; i < constraint.pointCount; i++)
+        {
+            constraint.pair->manifold.points[i].normalImpulse = constraint.points[i].normalImpulse;
+            constraint.pair->manifold.points[i].tangentImpulse = constraint.points[i].tangentImpulse;
+        }
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: UpdateSleep()
+{
+    const T linearTolerance = static_cast<T>(PHYSICS_SLEEP_LINEAR_TOLERANCE * PHYSICS_SLEEP_LINEAR_TOLERANCE);
+    const T angularTolerance = static_cast<T>(PHYSICS_SLEEP_ANGULAR_TOLERANCE * PHYSICS_SLEEP_ANGULAR_TOLERANCE);
+    const size_t bodyCount = ids.size();
+
+    for (size_t i = 0; i < bodyCount; i++)
+    {
+        if (!awake[i])
+        {
+            continue;
+        }
+
+        T speed = velocities[i].x * velocities[i].x + velocities[i].y * velocities[i].y;
+        if (speed > linearTolerance || angularVelocities[i] * angularVelocities[i] > angularTolerance)
+        {
+            sleepTimes[i] = 0;
+        }
+        else
+        {
+            sleepTimes[i] += timeStep;
+        }
+    }
+
+    // Islands of dynamic bodies joined by contacts, static bodies do not link islands
+    islandParents.resize(bodyCount);
+    for (size_t i = 0; i < bodyCount; i++)
+    {
+        islandParents[i] = static_cast<uint32_t>(i);
+    }
+    for (const ContactConstraint<T>& constraint : constraints)
+    {
+        if (inverseMasses[constraint.indexA] > 0 && inverseMasses[constraint.indexB] > 0)
+        {
+            uint32_t rootA = FindRoot(islandParents, constraint.indexA);
+            uint32_t rootB = FindRoot(islandParents, constraint.indexB);
+            islandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+        }
+    }
+
+    // An island sleeps only once its most restless body has been still long enough
+    islandSleepTimes.assign(bodyCount, static_cast<T>(PHYSICS_TIME_TO_SLEEP) * 2);
+    size_t islandCount = 0;
+    for (size_t i = 0; i < bodyCount; i++)
+    {
+        if (awake[i])
+        {
+            uint32_t root = FindRoot(islandParents, static_cast<uint32_t>(i));
+            islandCount += root == i;
+            islandSleepTimes[root] = std::min(islandSleepTimes[root], sleepTimes[i]);
+        }
+    }
+    stats.islandCount = islandCount;
+
+    if (!sleepingEnabled)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < bodyCount; i++)
+    {
+        if (awake[i] && islandSleepTimes[FindRoot(islandParents, static_cast<uint32_t>(i))] >= static_cast<T>(PHYSICS_TIME_TO_SLEEP))
+        {
+            SleepBody(i);
+        }
+    }
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetGravity(const Math::Vector2D<T>& p_gravity)
+{
+    gravity = p_gravity;
+}
+
+template <typename T>
+const Game::Math::Vector2D<T>& Game::Physics::RigidBodyWorld<T> :: GetGravity() const
+{
+    return gravity;
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetTimeStep(const T p_timeStep)
+{
+    if (p_timeStep > 0)
+    {
+        timeStep = p_timeStep;
+    }
+}
+
+template <typename T>
+T Game::Physics::RigidBodyWorld<T> :: GetTimeStep() const
+{
+    return timeStep;
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetVelocityIterations(int iterations)
+{
+    velocityIterations = std::max(iterations, 1);
+}
+
+template <typename T>
+int Game::Physics::RigidBodyWorld<T> :: GetVelocityIterations() const
+{
+    return velocityIterations;
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: SetSleepingEnabled(bool enabled)
+{
+    sleepingEnabled = enabled;
+    if (!enabled)
+    {
+        for (size_t i = 0; i < ids.size(); i++)
+        {
+            WakeBody(i);
+        }
+    }
+}
+
+template <typename T>
+bool Game::Physics::RigidBodyWorld<T> :: IsSleepingEnabled() const
+{
+    return sleepingEnabled;
+}
+
+template <typename T>
+bool Game::Physics::RigidBodyWorld<T> :: SetDeterministic(bool enabled)
+{
+    if (enabled && !PHYSICS_STRICT_FLOATING_POINT)
+    {
+        std::cerr << "RigidBodyWorld: Deterministic mode needs IEEE floating point, build without -ffast-math" << std::endl;
+        return false;
+    }
+
+    deterministic = enabled;
+    if (enabled)
+    {
+        Math::SetRandomSeed(PHYSICS_DETERMINISTIC_SEED);
+    }
+    return true;
+}
+
+template <typename T>
+bool Game::Physics::RigidBodyWorld<T> :: IsDeterministic() const
+{
+    return deterministic;
+}
+
+template <typename T>
+size_t Game::Physics::RigidBodyWorld<T> :: GetBodyCount() const
+{
+    return ids.size();
+}
+
+template <typename T>
+const uint32_t* Game::Physics::RigidBodyWorld<T> :: GetIds() const
+{
+    return ids.data();
+}
+
+template <typename T>
+const Game::Math::Vector2D<T>* Game::Physics::RigidBodyWorld<T> :: GetPositions() const
+{
+    return positions.data();
+}
+
+template <typename T>
+const T* Game::Physics::RigidBodyWorld<T> :: GetAngles() const
+{
+    return angles.data();
+}
+
+template <typename T>
+const Game::Physics::PhysicsStepStats& Game::Physics::RigidBodyWorld<T> :: GetStats() const
+{
+    return stats;
+}
+
+template <typename T>
+double Game::Physics::RigidBodyWorld<T> :: GetBodiesPerMillisecond() const
+{
+    return stats.totalMilliseconds > 0 ? stats.bodySteps / stats.totalMilliseconds : 0;
+}
+
+template <typename T>
+uint64_t Game::Physics::RigidBodyWorld<T> :: ComputeStateHash() const
+{
+    // FNV-1a over the bit patterns in lane order, which is itself part of the state
+    uint64_t hash = 0xCBF29CE484222325ull;
+    auto mix = [&hash](const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++)
+        {
+            hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+        }
+    };
+
+    for (size_t i = 0; i < ids.size(); i++)
+    {
+        mix(&ids[i], sizeof(uint32_t));
+        mix(&positions[i].x, sizeof(T));
+        mix(&positions[i].y, sizeof(T));
+        mix(&velocities[i].x, sizeof(T));
+        mix(&velocities[i].y, sizeof(T));
+        mix(&angles[i], sizeof(T));
+        mix(&angularVelocities[i], sizeof(T));
+        mix(&awake[i], sizeof(uint8_t));
+    }
+    return hash;
+}
+
+template <typename T>
+void Game::Physics::RigidBodyWorld<T> :: ResetStats()
+{
+    stats = PhysicsStepStats();
+}
+
+template <typename T>
+Game::Collision::CollisionWorld<T>& Game::Physics::RigidBodyWorld<T> :: GetCollisionWorld()
+{
+    return collisionWorld;
+}
+
+// Columns of boxes over a wide static ground, a mix of falling, stacking and sleeping work
+static void BuildBenchmarkScene(Game::Physics::RigidBodyWorld<float>& world, size_t bodyCount)
+{
+    size_t columns = std::max<size_t>(1, static_cast<size_t>(std::sqrt(static_cast<double>(bodyCount))));
+    float width = columns * 1.5f;
+    world.AddBody(Game::Collision::Shape_Box(Vector2D<float>(width / 2, 1.0f), Vector2D<float>(width, 0.5f)), 0.0f);
+    for (size_t i = 0; i < bodyCount; i++)
+    {
+        float x = (i % columns) * 1.5f + 0.75f;
+        float y = -static_cast<float>(i / columns) * 1.1f;
+        world.AddBody(Game::Collision::Shape_Box(Vector2D<float>(x, y), Vector2D<float>(0.5f, 0.5f)), 1.0f);
+    }
+}
+
+double Game::Physics::Physics_Benchmark(size_t bodyCount, size_t stepCount, size_t workerCount)
+{
+    RigidBodyWorld<float> world(workerCount);
+    BuildBenchmarkScene(world, bodyCount);
+
+    for (size_t i = 0; i < stepCount; i++)
+    {
+        world.Step();
+    }
+    return world.GetBodiesPerMillisecond();
+}
+
+bool Game::Physics::Physics_DeterminismCheck(size_t bodyCount, size_t stepCount, size_t workerCount)
+{
+    RigidBodyWorld<float> single(0);
+    RigidBodyWorld<float> parallel(workerCount);
+    if (!single.SetDeterministic(true) || !parallel.SetDeterministic(true))
+    {
+        return false;
+    }
+    BuildBenchmarkScene(single, bodyCount);
+    BuildBenchmarkScene(parallel, bodyCount);
+
+    for (size_t i = 0; i < stepCount; i++)
+    {
+        single.Step();
+        parallel.Step();
+        if (single.GetStats().stateHash != parallel.GetStats().stateHash)
+        {
+            std::cerr << "Physics_DeterminismCheck: State hashes differ at step " << i << " with " << workerCount << " workers" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+template class Game::Physics::RigidBodyWorld<float>;
+template class Game::Physics::RigidBodyWorld<double>;
@@ -0,0 +1,69 @@
+/**
+ *  \file ScratchArena.cpp
+ *
+ *  \brief Source file for ScratchArena.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Utils/ScratchArena.hpp"
+
+#include <algorithm>
+
+Game::Utils::ScratchArena :: ScratchArena(void* p_buffer, size_t p_capacity) : buffer(static_cast<unsigned char*>(p_buffer)), capacity(p_capacity), used(0), peak(0)
+{
+    if (buffer == nullptr)
+    {
+        capacity = 0;
+    }
+}
+
+void* Game::Utils::ScratchArena :: AllocateBytes(size_t size, size_t alignment)
+{
+    // Align the address rather than the offset, the buffer itself may be unaligned
+    uintptr_t address = reinterpret_cast<uintptr_t>(buffer) + used;
+    size_t padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+    if (padding > capacity - used || size > capacity - used - padding)
+    {
+        return nullptr;
+    }
+
+    void* slice = buffer + used + padding;
+    used += padding + size;
+    peak = std::max(peak, used);
+    return slice;
+}
+
+size_t Game::Utils::ScratchArena :: GetMarker() const
+{
+    return used;
+}
+
+void Game::Utils::ScratchArena :: Release(size_t marker)
+{
+    if (marker < used)
+    {
+        used = marker;
+    }
+}
+
+void Game::Utils::ScratchArena :: Reset()
+{
+    used = 0;
+}
+
+size_t Game::Utils::ScratchArena :: GetUsed() const
+{
+    return used;
+}
+
+size_t Game::Utils::ScratchArena :: GetCapacity() const
+{
+    return capacity;
+}
+
+size_t Game::Utils::ScratchArena :: GetPeak() const
+{
+    return peak;
+}
@@ -0,0 +1,230 @@
+/**
+ *  \file Shape.cpp
+ *
+ *  \brief Source file for Shape.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Collision/Shape.hpp"
+
+#include <cmath>
+#include <limits>
+
+template <typename T>
+static Game::Math::Vector2D<T> ToWorld(const Game::Collision::Shape<T>& shape, const Game::Math::Vector2D<T>& local)
+{
+    const Game::Math::Vector2D<T>& r = shape.orientation;
+    return Game::Math::Vector2D<T>(shape.position.x + local.x * r.x - local.y * r.y,
+                                   shape.position.y + local.x * r.y + local.y * r.x);
+}
+
+template <typename T>
+static Game::Math::Vector2D<T> ToLocalDirection(const Game::Collision::Shape<T>& shape, const Game::Math::Vector2D<T>& direction)
+{
+    const Game::Math::Vector2D<T>& r = shape.orientation;
+    return Game::Math::Vector2D<T>(direction.x * r.x + direction.y * r.y, -direction.x * r.y + direction.y * r.x);
+}
+
+template <typename T>
+Game::Collision::Shape<T> :: Shape() : type(ShapeType::Circle), position(), rotation(0), orientation(1, 0), radius(0),
+                                       halfExtents(), vertices(nullptr), vertexCount(0)
+{
+
+}
+
+template <typename T>
+Game::Math::Vector2D<T> Game::Collision::Shape<T> :: Support(const Math::Vector2D<T>& direction) const
+{
+    Math::Vector2D<T> local = ToLocalDirection(*this, direction);
+
+    switch (type)
+    {
+        case ShapeType::Circle:
+            return position + direction.Normalize() * radius;
+
+        case ShapeType::Box:
+            return ToWorld(*this, Math::Vector2D<T>(local.x >= 0 ? halfExtents.x : -halfExtents.x,
+                                                    local.y >= 0 ? halfExtents.y : -halfExtents.y));
+
+        case ShapeType::Capsule:
+            return ToWorld(*this, Math::Vector2D<T>(local.x >= 0 ? halfExtents.x : -halfExtents.x, 0)) + direction.Normalize() * radius;
+
+        case ShapeType::Polygon:
+        {
+            size_t best = 0;
+            T bestProjection = -std::numeric_limits<T>::max();
+            for (size_t i = 0; i < vertexCount; i++)
+            {
+                T projection = vertices[i].x * local.x + vertices[i].y * local.y;
+                if (projection > bestProjection)
+                {
+                    bestProjection = projection;
+                    best = i;
+                }
+            }
+            return vertexCount == 0 ? position : ToWorld(*this, vertices[best]);
+        }
+    }
+
+    return position;
+}
+
+template <typename T>
+Game::Math::Vector2D<T> Game::Collision::Shape<T> :: GetCenter() const
+{
+    return position;
+}
+
+template <typename T>
+Game::Collision::AABB<T> Game::Collision::Shape<T> :: ComputeAABB() const
+{
+    T c = std::abs(orientation.x);
+    T s = std::abs(orientation.y);
+    Math::Vector2D<T> extents;
+
+    switch (type)
+    {
+        case ShapeType::Circle:
+            extents = Math::Vector2D<T>(radius, radius);
+            break;
+
+        case ShapeType::Box:
+            extents = Math::Vector2D<T>(c * halfExtents.x + s * halfExtents.y, s * halfExtents.x + c * halfExtents.y);
+            break;
+
+        case ShapeType::Capsule:
+            extents = Math::Vector2D<T>(c * halfExtents.x + radius, s * halfExtents.x + radius);
+            break;
+
+        case ShapeType::Polygon:
+        {
+            if (vertexCount == 0)
+            {
+                return AABB<T>(position, position);
+            }
+
+            AABB<T> bounds(ToWorld(*this, vertices[0]), ToWorld(*this, vertices[0]));
+            for (size_t i = 1; i < vertexCount; i++)
+            {
+                Math::Vector2D<T> world = ToWorld(*this, vertices[i]);
+                bounds.min = Math::Vector2D<T>(std::min(bounds.min.x, world.x), std::min(bounds.min.y, world.y));
+                bounds.max = Math::Vector2D<T>(std::max(bounds.max.x, world.x), std::max(bounds.max.y, world.y));
+            }
+            return bounds;
+        }
+    }
+
+    return AABB<T>(position - extents, position + extents);
+}
+
+template <typename T>
+Game::Math::Vector2D<T> Game::Collision::Shape<T> :: GetVertex(const size_t index) const
+{
+    switch (type)
+    {
+        case ShapeType::Box:
+        {
+            // Counter clockwise, starting bottom left
+            T x = (index == 1 || index == 2) ? halfExtents.x : -halfExtents.x;
+            T y = (index >= 2) ? halfExtents.y : -halfExtents.y;
+            return ToWorld(*this, Math::Vector2D<T>(x, y));
+        }
+
+        case ShapeType::Capsule:
+            return ToWorld(*this, Math::Vector2D<T>(index == 0 ? -halfExtents.x : halfExtents.x, 0));
+
+        case ShapeType::Polygon:
+            return ToWorld(*this, vertices[index]);
+
+        default:
+            return position;
+    }
+}
+
+template <typename T>
+size_t Game::Collision::Shape<T> :: GetVertexCount() const
+{
+    switch (type)
+    {
+        case ShapeType::Box:
+            return 4;
+        case ShapeType::Capsule:
+            return 2;
+        case ShapeType::Polygon:
+            return vertexCount;
+        default:
+            return 0;
+    }
+}
+
+template <typename T>
+void Game::Collision::Shape<T> :: SetRotation(const T angle)
+{
+    rotation = angle;
+    orientation = Math::Vector2D<T>(std::cos(angle), std::sin(angle));
+}
+
+template <typename T>
+void Game::Collision::Shape<T> :: SetPosition(const Math::Vector2D<T>& p_position)
+{
+    position = p_position;
+}
+
+template <typename T>
+Game::Collision::Shape<T> Game::Collision::Shape_Circle(const Math::Vector2D<T>& position, const T radius)
+{
+    Shape<T> shape;
+    shape.type = ShapeType::Circle;
+    shape.position = position;
+    shape.radius = radius;
+    return shape;
+}
+
+template <typename T>
+Game::Collision::Shape<T> Game::Collision::Shape_Box(const Math::Vector2D<T>& position, const Math::Vector2D<T>& halfExtents, const T rotation)
+{
+    Shape<T> shape;
+    shape.type = ShapeType::Box;
+    shape.position = position;
+    shape.halfExtents = halfExtents;
+    shape.SetRotation(rotation);
+    return shape;
+}
+
+template <typename T>
+Game::Collision::Shape<T> Game::Collision::Shape_Capsule(const Math::Vector2D<T>& position, const T halfLength, const T radius, const T rotation)
+{
+    Shape<T> shape;
+    shape.type = ShapeType::Capsule;
+    shape.position = position;
+    shape.halfExtents = Math::Vector2D<T>(halfLength, 0);
+    shape.radius = radius;
+    shape.SetRotation(rotation);
+    return shape;
+}
+
+template <typename T>
+Game::Collision::Shape<T> Game::Collision::Shape_Polygon(const Math::Vector2D<T>& position, const Math::Vector2D<T>* vertices, const size_t vertexCount, const T rotation)
+{
+    Shape<T> shape;
+    shape.type = ShapeType::Polygon;
+    shape.position = position;
+    shape.vertices = vertices;
+    shape.vertexCount = vertexCount;
+    shape.SetRotation(rotation);
+    return shape;
+}
+
+template struct Game::Collision::Shape<float>;
+template struct Game::Collision::Shape<double>;
+
+template Game::Collision::Shape<float> Game::Collision::Shape_Circle(const Game::Math::Vector2D<float>&, const float);
+template Game::Collision::Shape<double> Game::Collision::Shape_Circle(const Game::Math::Vector2D<double>&, const double);
+template Game::Collision::Shape<float> Game::Collision::Shape_Box(const Game::Math::Vector2D<float>&, const Game::Math::Vector2D<float>&, const float);
+template Game::Collision::Shape<double> Game::Collision::Shape_Box(const Game::Math::Vector2D<double>&, const Game::Math::Vector2D<double>&, const double);
+template Game::Collision::Shape<float> Game::Collision::Shape_Capsule(const Game::Math::Vector2D<float>&, const float, const float, const float);
+template Game::Collision::Shape<double> Game::Collision::Shape_Capsule(const Game::Math::Vector2D<double>&, const double, const double, const double);
+template Game::Collision::Shape<float> Game::Collision::Shape_Polygon(const Game::Math::Vector2D<float>&, const Game::Math::Vector2D<float>*, const size_t, const float);
+template Game::Collision::Shape<double> Game::Collision::Shape_Polygon(const Game::Math::Vector2D<double>&, const Game::Math::Vector2D<double>*, const size_t, const double);
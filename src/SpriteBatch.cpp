@@ -0,0 +1,270 @@
+/**
+ *  \file SpriteBatch.cpp
+ *
+ *  \brief Source file for SpriteBatch.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Graphics/SpriteBatch.hpp"
+
+#include <cmath>
+#include <iostream>
+
+Game::Graphics::SpriteBatch :: SpriteBatch(SDL_Renderer* p_renderer, size_t p_capacity) : renderer(p_renderer), capacity(std::max<size_t>(p_capacity, 1)),
+    isDrawing(false), sortMode(SpriteSortMode::Texture), sizedTexture(nullptr), textureWidth(0), textureHeight(0), cullRegion(), isCulling(false), stats()
+{
+    items.reserve(capacity);
+    keys.reserve(capacity);
+    vertices.resize(capacity * 4);
+    indices.resize(capacity * 6);
+    for (size_t i = 0; i < capacity; i++)
+    {
+        int first = static_cast<int>(i * 4);
+        int* quad = &indices[i * 6];
+        quad[0] = first;
+        quad[1] = first + 1;
+        quad[2] = first + 2;
+        quad[3] = first + 2;
+        quad[4] = first + 3;
+        quad[5] = first;
+    }
+}
+
+bool Game::Graphics::SpriteBatch :: Begin(SpriteSortMode mode)
+{
+    if (isDrawing)
+    {
+        std::cerr << "SpriteBatch: Begin() called twice without End()" << std::endl;
+        return false;
+    }
+    isDrawing = true;
+    sortMode = mode;
+    return true;
+}
+
+void Game::Graphics::SpriteBatch :: Draw(SDL_Texture* texture, const SDL_FRect& destination, const SDL_FRect& uv, int layer, SDL_Color color, float angle)
+{
+    if (!isDrawing)
+    {
+        std::cerr << "SpriteBatch: Draw() called outside Begin() and End()" << std::endl;
+        return;
+    }
+
+    if (isCulling)
+    {
+        // A rotated sprite stays inside the circle through its corners
+        float margin = 0;
+        if (angle != 0)
+        {
+            margin = std::sqrt(destination.w * destination.w + destination.h * destination.h) / 2 - std::min(destination.w, destination.h) / 2;
+        }
+        if (destination.x + destination.w + margin < cullRegion.x || destination.x - margin > cullRegion.x + cullRegion.w ||
+            destination.y + destination.h + margin < cullRegion.y || destination.y - margin > cullRegion.y + cullRegion.h)
+        {
+            stats.culledCount++;
+            return;
+        }
+    }
+
+    if (items.size() == capacity)
+    {
+        Flush();
+    }
+
+    SpriteItem item;
+    item.texture = texture;
+    item.destination = destination;
+    item.uv = uv;
+    item.color = color;
+    item.angle = angle;
+    items.push_back(item);
+
+    uint64_t biasedLayer = static_cast<uint32_t>(layer) ^ 0x80000000u;
+    keys.push_back(sortMode == SpriteSortMode::Texture ? (biasedLayer << 32) | GetTextureSlot(texture) : 0);
+}
+
+void Game::Graphics::SpriteBatch :: Draw(SDL_Texture* texture, const SDL_Rect* source, const SDL_FRect& destination, int layer, SDL_Color color, float angle)
+{
+    SDL_FRect uv = { 0, 0, 1, 1 };
+    if (source != nullptr)
+    {
+        if (texture != sizedTexture)
+        {
+            if (texture == nullptr || SDL_QueryTexture(texture, nullptr, nullptr, &textureWidth, &textureHeight) != 0)
+            {
+                textureWidth = textureHeight = 1;
+            }
+            sizedTexture = texture;
+        }
+        uv.x = static_cast<float>(source->x) / textureWidth;
+        uv.y = static_cast<float>(source->y) / textureHeight;
+        uv.w = static_cast<float>(source->w) / textureWidth;
+        uv.h = static_cast<float>(source->h) / textureHeight;
+    }
+    Draw(texture, destination, uv, layer, color, angle);
+}
+
+bool Game::Graphics::SpriteBatch :: End()
+{
+    if (!isDrawing)
+    {
+        std::cerr << "SpriteBatch: End() called without Begin()" << std::endl;
+        return false;
+    }
+    Flush();
+    isDrawing = false;
+    return true;
+}
+
+void Game::Graphics::SpriteBatch :: SetCullRegion(const SDL_FRect& region)
+{
+    cullRegion = region;
+    isCulling = true;
+}
+
+void Game::Graphics::SpriteBatch :: DisableCulling()
+{
+    isCulling = false;
+}
+
+bool Game::Graphics::SpriteBatch :: IsCulling() const
+{
+    return isCulling;
+}
+
+void Game::Graphics::SpriteBatch :: QueryVisible(const Collision::Quadtree<float>& tree, Math::DynamicArray<uint32_t>& results) const
+{
+    if (!isCulling)
+    {
+        results.clear();
+        for (size_t i = 0; i < tree.GetItemCount(); i++)
+        {
+            results.push_back(tree.GetItems()[i].id);
+        }
+        return;
+    }
+
+    Collision::AABB<float> region(Math::Vector2D<float>(cullRegion.x, cullRegion.y),
+                                  Math::Vector2D<float>(cullRegion.x + cullRegion.w, cullRegion.y + cullRegion.h));
+    tree.QueryRegion(region, results);
+}
+
+SDL_Renderer* Game::Graphics::SpriteBatch :: GetRenderer() const
+{
+    return renderer;
+}
+
+size_t Game::Graphics::SpriteBatch :: GetCapacity() const
+{
+    return capacity;
+}
+
+size_t Game::Graphics::SpriteBatch :: GetQueuedCount() const
+{
+    return items.size();
+}
+
+const Game::Graphics::SpriteBatchStats& Game::Graphics::SpriteBatch :: GetStats() const
+{
+    return stats;
+}
+
+void Game::Graphics::SpriteBatch :: ResetStats()
+{
+    stats = SpriteBatchStats();
+}
+
+void Game::Graphics::SpriteBatch :: Flush()
+{
+    size_t count = items.size();
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Deferred keys are all 0, the stable sort would leave them in place
+    const uint32_t* order = nullptr;
+    if (sortMode == SpriteSortMode::Texture)
+    {
+        sorter.Sort(keys.data(), count);
+        order = sorter.GetPermutation();
+    }
+
+    size_t runStart = 0;
+    SDL_Texture* runTexture = nullptr;
+    for (size_t i = 0; i <= count; i++)
+    {
+        const SpriteItem* item = i < count ? &items[order != nullptr ? order[i] : i] : nullptr;
+        if (i > runStart && (item == nullptr || item->texture != runTexture))
+        {
+            int quadCount = static_cast<int>(i - runStart);
+            if (SDL_RenderGeometry(renderer, runTexture, &vertices[runStart * 4], quadCount * 4, indices.data(), quadCount * 6) != 0)
+            {
+                std::cerr << "SpriteBatch: SDL_RenderGeometry failed: " << SDL_GetError() << std::endl;
+            }
+            stats.drawCalls++;
+            runStart = i;
+        }
+        if (item != nullptr)
+        {
+            WriteQuad(*item, &vertices[i * 4]);
+            runTexture = item->texture;
+        }
+    }
+
+    stats.spriteCount += count;
+    stats.mergedCount = stats.spriteCount - stats.drawCalls;
+    stats.flushCount++;
+    items.clear();
+    keys.clear();
+    textureSlots.clear();
+}
+
+void Game::Graphics::SpriteBatch :: WriteQuad(const SpriteItem& item, SDL_Vertex* quad) const
+{
+    const SDL_FRect& rect = item.destination;
+    const SDL_FRect& uv = item.uv;
+
+    // Corners clockwise from the top left
+    float cornersX[4] = { rect.x, rect.x + rect.w, rect.x + rect.w, rect.x };
+    float cornersY[4] = { rect.y, rect.y, rect.y + rect.h, rect.y + rect.h };
+    float u[4] = { uv.x, uv.x + uv.w, uv.x + uv.w, uv.x };
+    float v[4] = { uv.y, uv.y, uv.y + uv.h, uv.y + uv.h };
+
+    if (item.angle != 0)
+    {
+        float radians = item.angle * static_cast<float>(M_PI) / 180.0f;
+        float cosine = std::cos(radians), sine = std::sin(radians);
+        float centerX = rect.x + rect.w / 2, centerY = rect.y + rect.h / 2;
+        for (int corner = 0; corner < 4; corner++)
+        {
+            float x = cornersX[corner] - centerX, y = cornersY[corner] - centerY;
+            cornersX[corner] = centerX + x * cosine - y * sine;
+            cornersY[corner] = centerY + x * sine + y * cosine;
+        }
+    }
+
+    for (int corner = 0; corner < 4; corner++)
+    {
+        quad[corner].position.x = cornersX[corner];
+        quad[corner].position.y = cornersY[corner];
+        quad[corner].color = item.color;
+        quad[corner].tex_coord.x = u[corner];
+        quad[corner].tex_coord.y = v[corner];
+    }
+}
+
+uint32_t Game::Graphics::SpriteBatch :: GetTextureSlot(SDL_Texture* texture)
+{
+    // Slots follow first use, so runs of one texture come out in the order they were drawn
+    auto found = textureSlots.find(texture);
+    if (found != textureSlots.end())
+    {
+        return found->second;
+    }
+    uint32_t slot = static_cast<uint32_t>(textureSlots.size());
+    textureSlots.emplace(texture, slot);
+    return slot;
+}
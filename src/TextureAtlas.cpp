@@ -0,0 +1,443 @@
+/**
+ *  \file TextureAtlas.cpp
+ *
+ *  \brief Source file for TextureAtlas.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Graphics/TextureAtlas.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "SDL2/SDL_image.h"
+
+static Game::Math::String PagePath(const char* basePath, size_t page)
+{
+    return Game::Math::String(basePath) + "_" + std::to_string(page) + ".png";
+}
+
+static Game::Math::String IndexPath(const char* basePath)
+{
+    return Game::Math::String(basePath) + ".atlas";
+}
+
+Game::Graphics::SkylinePacker :: SkylinePacker() : width(0), height(0), usedArea(0)
+{
+
+}
+
+Game::Graphics::SkylinePacker :: SkylinePacker(int p_width, int p_height) : width(0), height(0), usedArea(0)
+{
+    Reset(p_width, p_height);
+}
+
+bool Game::Graphics::SkylinePacker :: Insert(int w, int h, SDL_Rect& result)
+{
+    if (w <= 0 || h <= 0)
+    {
+        return false;
+    }
+
+    size_t bestIndex = skyline.size();
+    int bestTop = height + 1, bestWidth = width + 1;
+    for (size_t i = 0; i < skyline.size(); i++)
+    {
+        int y = Fit(i, w, h);
+        if (y >= 0 && (y + h < bestTop || (y + h == bestTop && skyline[i].width < bestWidth)))
+        {
+            bestIndex = i;
+            bestTop = y + h;
+            bestWidth = skyline[i].width;
+        }
+    }
+    if (bestIndex == skyline.size())
+    {
+        return false;
+    }
+
+    result.x = skyline[bestIndex].x;
+    result.y = bestTop - h;
+    result.w = w;
+    result.h = h;
+    usedArea += static_cast<uint64_t>(w) * h;
+
+    // The new segment covers w pixels, segments it overlaps are shortened or removed
+    SkylineSegment segment = { result.x, bestTop, w };
+    skyline.insert(skyline.begin() + bestIndex, segment);
+    size_t next = bestIndex + 1;
+    while (next < skyline.size() && skyline[next].x < segment.x + segment.width)
+    {
+        int shrink = segment.x + segment.width - skyline[next].x;
+        if (shrink < skyline[next].width)
+        {
+            skyline[next].x += shrink;
+            skyline[next].width -= shrink;
+            break;
+        }
+        skyline.erase(skyline.begin() + next);
+    }
+
+    // Neighbours at the same height become one segment
+    for (size_t i = 0; i + 1 < skyline.size(); )
+    {
+        if (skyline[i].y == skyline[i + 1].y)
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else
+        {
+            i++;
+        }
+    }
+    return true;
+}
+
+void Game::Graphics::SkylinePacker :: Reset(int p_width, int p_height)
+{
+    width = std::max(p_width, 0);
+    height = std::max(p_height, 0);
+    usedArea = 0;
+    skyline.clear();
+    skyline.push_back(SkylineSegment{ 0, 0, width });
+}
+
+int Game::Graphics::SkylinePacker :: GetWidth() const
+{
+    return width;
+}
+
+int Game::Graphics::SkylinePacker :: GetHeight() const
+{
+    return height;
+}
+
+double Game::Graphics::SkylinePacker :: GetOccupancy() const
+{
+    return width > 0 && height > 0 ? static_cast<double>(usedArea) / (static_cast<double>(width) * height) : 0;
+}
+
+int Game::Graphics::SkylinePacker :: Fit(size_t index, int w, int h) const
+{
+    // The rectangle rests on the highest segment under its width
+    if (skyline[index].x + w > width)
+    {
+        return -1;
+    }
+
+    int y = 0;
+    for (int remaining = w; remaining > 0; index++)
+    {
+        y = std::max(y, skyline[index].y);
+        if (y + h > height)
+        {
+            return -1;
+        }
+        remaining -= skyline[index].width;
+    }
+    return y;
+}
+
+Game::Graphics::TextureAtlas :: TextureAtlas(int p_pageWidth, int p_pageHeight, int p_padding) : pageWidth(p_pageWidth), pageHeight(p_pageHeight), padding(std::max(p_padding, 0))
+{
+
+}
+
+Game::Graphics::TextureAtlas :: ~TextureAtlas()
+{
+    Clear();
+}
+
+bool Game::Graphics::TextureAtlas :: AddSurface(const char* name, SDL_Surface* surface, bool takeOwnership)
+{
+    if (surface == nullptr || name == nullptr || lookup.count(name) != 0)
+    {
+        std::cerr << "TextureAtlas: Can't add " << (name != nullptr ? name : "(null)") << ", missing surface or duplicate name" << std::endl;
+        if (takeOwnership && surface != nullptr)
+        {
+            SDL_FreeSurface(surface);
+        }
+        return false;
+    }
+
+    lookup.emplace(name, static_cast<uint32_t>(regions.size()));
+    names.push_back(name);
+    regions.push_back(AtlasRegion{ -1, SDL_Rect{ 0, 0, surface->w, surface->h }, SDL_FRect{ 0, 0, 0, 0 }, nullptr });
+    sources.push_back(AtlasSource{ surface, takeOwnership });
+    return true;
+}
+
+bool Game::Graphics::TextureAtlas :: AddImage(const char* name, const char* path)
+{
+    SDL_Surface* surface = IMG_Load(path);
+    if (surface == nullptr)
+    {
+        std::cerr << "TextureAtlas: Can't load " << path << ": " << IMG_GetError() << std::endl;
+        return false;
+    }
+    return AddSurface(name, surface, true);
+}
+
+bool Game::Graphics::TextureAtlas :: Build(SDL_Renderer* renderer)
+{
+    // Tallest first keeps the skyline flat, sources added since the last Build() only
+    Math::DynamicArray<uint32_t> order;
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        if (sources[i].surface != nullptr && regions[i].page < 0)
+        {
+            order.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b)
+    {
+        return regions[a].rect.h != regions[b].rect.h ? regions[a].rect.h > regions[b].rect.h : regions[a].rect.w > regions[b].rect.w;
+    });
+
+    bool isComplete = true;
+    for (uint32_t index : order)
+    {
+        AtlasRegion& region = regions[index];
+        SDL_Rect placed;
+        int w = region.rect.w + padding * 2, h = region.rect.h + padding * 2;
+        if (w > pageWidth || h > pageHeight)
+        {
+            std::cerr << "TextureAtlas: " << names[index] << " does not fit on a " << pageWidth << "x" << pageHeight << " page" << std::endl;
+            isComplete = false;
+            continue;
+        }
+
+        size_t page = 0;
+        while (page < pages.size() && (pages[page].surface == nullptr || !pages[page].packer.Insert(w, h, placed)))
+        {
+            page++;
+        }
+        if (page == pages.size())
+        {
+            SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, pageWidth, pageHeight, 32, SDL_PIXELFORMAT_RGBA32);
+            if (surface == nullptr)
+            {
+                std::cerr << "TextureAtlas: Can't create page surface: " << SDL_GetError() << std::endl;
+                return false;
+            }
+            SDL_FillRect(surface, nullptr, 0);
+            pages.push_back(AtlasPage{ surface, nullptr, SkylinePacker(pageWidth, pageHeight), true });
+            pages.back().packer.Insert(w, h, placed);
+        }
+
+        region.page = static_cast<int>(page);
+        region.rect.x = placed.x + padding;
+        region.rect.y = placed.y + padding;
+        region.uv = SDL_FRect{ static_cast<float>(region.rect.x) / pageWidth, static_cast<float>(region.rect.y) / pageHeight,
+                               static_cast<float>(region.rect.w) / pageWidth, static_cast<float>(region.rect.h) / pageHeight };
+
+        // Copy the pixels as they are, alpha included, instead of blending them onto the page
+        SDL_Surface* source = sources[index].surface;
+        SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+        SDL_GetSurfaceBlendMode(source, &blendMode);
+        SDL_SetSurfaceBlendMode(source, SDL_BLENDMODE_NONE);
+        SDL_Rect destination = region.rect;
+        if (SDL_BlitSurface(source, nullptr, pages[page].surface, &destination) != 0)
+        {
+            std::cerr << "TextureAtlas: Can't copy " << names[index] << ": " << SDL_GetError() << std::endl;
+            isComplete = false;
+        }
+        pages[page].isDirty = true;
+        SDL_SetSurfaceBlendMode(source, blendMode);
+    }
+
+    ReleaseSources();
+    return CreateTextures(renderer) && isComplete;
+}
+
+bool Game::Graphics::TextureAtlas :: Save(const char* basePath) const
+{
+    Math::String indexPath = IndexPath(basePath);
+    std::ofstream index(indexPath);
+    if (!index)
+    {
+        std::cerr << "TextureAtlas: Can't write " << indexPath << std::endl;
+        return false;
+    }
+
+    // One line per region, the name last so it may contain spaces
+    index << "atlas " << pages.size() << ' ' << pageWidth << ' ' << pageHeight << '\n';
+    for (size_t i = 0; i < regions.size(); i++)
+    {
+        const AtlasRegion& region = regions[i];
+        index << region.page << ' ' << region.rect.x << ' ' << region.rect.y << ' ' << region.rect.w << ' ' << region.rect.h << ' ' << names[i] << '\n';
+    }
+
+    for (size_t page = 0; page < pages.size(); page++)
+    {
+        if (pages[page].surface == nullptr || IMG_SavePNG(pages[page].surface, PagePath(basePath, page).c_str()) != 0)
+        {
+            std::cerr << "TextureAtlas: Can't write page " << page << ": " << IMG_GetError() << std::endl;
+            return false;
+        }
+    }
+    return static_cast<bool>(index);
+}
+
+bool Game::Graphics::TextureAtlas :: Load(SDL_Renderer* renderer, const char* basePath)
+{
+    Clear();
+
+    Math::String indexPath = IndexPath(basePath);
+    std::ifstream index(indexPath);
+    Math::String header;
+    size_t pageCount = 0;
+    if (!(index >> header >> pageCount >> pageWidth >> pageHeight) || header != "atlas")
+    {
+        std::cerr << "TextureAtlas: " << indexPath << " is not an atlas index" << std::endl;
+        return false;
+    }
+
+    for (size_t page = 0; page < pageCount; page++)
+    {
+        SDL_Surface* surface = IMG_Load(PagePath(basePath, page).c_str());
+        if (surface == nullptr)
+        {
+            std::cerr << "TextureAtlas: Can't load page " << page << ": " << IMG_GetError() << std::endl;
+            Clear();
+            return false;
+        }
+        pages.push_back(AtlasPage{ surface, nullptr, SkylinePacker(), true });
+    }
+
+    Math::String line;
+    std::getline(index, line);
+    while (std::getline(index, line))
+    {
+        std::istringstream fields(line);
+        AtlasRegion region = { -1, SDL_Rect{ 0, 0, 0, 0 }, SDL_FRect{ 0, 0, 0, 0 }, nullptr };
+        Math::String name;
+        if (!(fields >> region.page >> region.rect.x >> region.rect.y >> region.rect.w >> region.rect.h) || region.page >= static_cast<int>(pageCount))
+        {
+            continue;
+        }
+        fields.get();
+        std::getline(fields, name);
+
+        region.uv = SDL_FRect{ static_cast<float>(region.rect.x) / pageWidth, static_cast<float>(region.rect.y) / pageHeight,
+                               static_cast<float>(region.rect.w) / pageWidth, static_cast<float>(region.rect.h) / pageHeight };
+        lookup.emplace(name, static_cast<uint32_t>(regions.size()));
+        names.push_back(name);
+        regions.push_back(region);
+        sources.push_back(AtlasSource{ nullptr, false });
+    }
+    return CreateTextures(renderer);
+}
+
+void Game::Graphics::TextureAtlas :: ReleaseSurfaces()
+{
+    for (AtlasPage& page : pages)
+    {
+        if (page.surface != nullptr)
+        {
+            SDL_FreeSurface(page.surface);
+            page.surface = nullptr;
+        }
+    }
+}
+
+void Game::Graphics::TextureAtlas :: Clear()
+{
+    ReleaseSources();
+    ReleaseSurfaces();
+    for (AtlasPage& page : pages)
+    {
+        if (page.texture != nullptr)
+        {
+            SDL_DestroyTexture(page.texture);
+        }
+    }
+    pages.clear();
+    names.clear();
+    regions.clear();
+    sources.clear();
+    lookup.clear();
+}
+
+const Game::Graphics::AtlasRegion* Game::Graphics::TextureAtlas :: Find(const char* name) const
+{
+    auto found = lookup.find(name);
+    if (found == lookup.end() || regions[found->second].page < 0)
+    {
+        return nullptr;
+    }
+    return &regions[found->second];
+}
+
+SDL_Texture* Game::Graphics::TextureAtlas :: GetTexture(int page) const
+{
+    return page >= 0 && static_cast<size_t>(page) < pages.size() ? pages[page].texture : nullptr;
+}
+
+SDL_Surface* Game::Graphics::TextureAtlas :: GetSurface(int page) const
+{
+    return page >= 0 && static_cast<size_t>(page) < pages.size() ? pages[page].surface : nullptr;
+}
+
+size_t Game::Graphics::TextureAtlas :: GetPageCount() const
+{
+    return pages.size();
+}
+
+size_t Game::Graphics::TextureAtlas :: GetRegionCount() const
+{
+    return regions.size();
+}
+
+bool Game::Graphics::TextureAtlas :: CreateTextures(SDL_Renderer* renderer)
+{
+    if (renderer == nullptr)
+    {
+        return true;
+    }
+
+    // Pages that gained images since their texture was made are uploaded again
+    for (AtlasPage& page : pages)
+    {
+        if (page.surface == nullptr || (!page.isDirty && page.texture != nullptr))
+        {
+            continue;
+        }
+        if (page.texture != nullptr)
+        {
+            SDL_DestroyTexture(page.texture);
+        }
+        page.texture = SDL_CreateTextureFromSurface(renderer, page.surface);
+        if (page.texture == nullptr)
+        {
+            std::cerr << "TextureAtlas: Can't create page texture: " << SDL_GetError() << std::endl;
+            return false;
+        }
+        SDL_SetTextureBlendMode(page.texture, SDL_BLENDMODE_BLEND);
+        page.isDirty = false;
+    }
+
+    for (AtlasRegion& region : regions)
+    {
+        region.texture = GetTexture(region.page);
+    }
+    return true;
+}
+
+void Game::Graphics::TextureAtlas :: ReleaseSources()
+{
+    for (AtlasSource& source : sources)
+    {
+        if (source.isOwned && source.surface != nullptr)
+        {
+            SDL_FreeSurface(source.surface);
+        }
+        source.surface = nullptr;
+        source.isOwned = false;
+    }
+}
@@ -0,0 +1,178 @@
+/**
+ *  \file ThreadPool.cpp
+ *
+ *  \brief Source file for ThreadPool.hpp.
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Utils/ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace
+{
+
+// Shared with helper jobs, which may start after ParallelFor() already returned
+struct ParallelForState
+{
+    std::atomic<size_t> next;
+    std::atomic<size_t> done;
+    size_t count;
+    std::function<void(size_t, size_t)> function;
+    std::mutex mutex;
+    std::condition_variable finished;
+};
+
+void RunTasks(ParallelForState& state, size_t worker)
+{
+    for (size_t task = state.next.fetch_add(1); task < state.count; task = state.next.fetch_add(1))
+    {
+        state.function(task, worker);
+        if (state.done.fetch_add(1) + 1 == state.count)
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.finished.notify_all();
+        }
+    }
+}
+
+} // namespace
+
+Game::Utils::ThreadPool :: ThreadPool() : activeJobs(0), stopping(false)
+{
+    unsigned int hardware = std::thread::hardware_concurrency();
+    Start(hardware > 1 ? hardware - 1 : 0);
+}
+
+Game::Utils::ThreadPool :: ThreadPool(size_t workerCount) : activeJobs(0), stopping(false)
+{
+    Start(workerCount);
+}
+
+Game::Utils::ThreadPool :: ~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobAvailable.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void Game::Utils::ThreadPool :: Start(size_t workerCount)
+{
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+void Game::Utils::ThreadPool :: WorkerLoop(size_t worker)
+{
+    for (;;)
+    {
+        std::function<void(size_t)> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobAvailable.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (stopping && jobs.empty())
+            {
+                return;
+            }
+            job = std::move(jobs.front());
+            jobs.pop_front();
+            activeJobs++;
+        }
+
+        job(worker);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            activeJobs--;
+            if (activeJobs == 0 && jobs.empty())
+            {
+                jobsFinished.notify_all();
+            }
+        }
+    }
+}
+
+void Game::Utils::ThreadPool :: ParallelFor(size_t taskCount, const std::function<void(size_t task, size_t worker)>& function)
+{
+    if (taskCount == 0)
+    {
+        return;
+    }
+
+    // The caller always takes part, so a pool without workers simply runs serially
+    if (workers.empty() || taskCount == 1)
+    {
+        for (size_t task = 0; task < taskCount; task++)
+        {
+            function(task, workers.size());
+        }
+        return;
+    }
+
+    std::shared_ptr<ParallelForState> state = std::make_shared<ParallelForState>();
+    state->next = 0;
+    state->done = 0;
+    state->count = taskCount;
+    state->function = function;
+
+    size_t helpers = std::min(workers.size(), taskCount - 1);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < helpers; i++)
+        {
+            jobs.emplace_back([state](size_t worker) { RunTasks(*state, worker); });
+        }
+    }
+    jobAvailable.notify_all();
+
+    RunTasks(*state, workers.size());
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&state] { return state->done.load() == state->count; });
+}
+
+void Game::Utils::ThreadPool :: Submit(std::function<void()> job)
+{
+    if (workers.empty())
+    {
+        job();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.emplace_back([job = std::move(job)](size_t) { job(); });
+    }
+    jobAvailable.notify_one();
+}
+
+void Game::Utils::ThreadPool :: Wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    jobsFinished.wait(lock, [this] { return activeJobs == 0 && jobs.empty(); });
+}
+
+size_t Game::Utils::ThreadPool :: GetWorkerCount() const
+{
+    return workers.size();
+}
+
+size_t Game::Utils::ThreadPool :: GetSlotCount() const
+{
+    // Workers plus the thread calling ParallelFor()
+    return workers.size() + 1;
+}
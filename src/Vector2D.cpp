@@ -12,6 +12,7 @@
 #include "Math/Vector2D.hpp"
 #include "Utils/Exceptions/Math_Exception.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 
@@ -144,7 +145,7 @@ double Game::Math::Vector2D<T> :: DotProduct(const Game::Math::Vector2D<T>& othe
 template <typename T>
 double Game::Math::Vector2D<T> :: CrossProduct(const Game::Math::Vector2D<T>& other) const
 {
-    return x * other.x - y * other.y;
+    return x * other.y - y * other.x;
 }
 
 template <typename T>
@@ -163,10 +164,10 @@ Game::Math::Vector2D<T> Game::Math::Vector2D<T> :: Normalize() const
     if (std::abs(mag) < VEC2D_TOLERANCE_VALUE)
     {
         NormalizedVector.x = NormalizedVector.y = 0.0f;
+        return NormalizedVector;
     }
     NormalizedVector = Vector2D<T>(x / mag, y / mag);
     
-    *this = NormalizedVector;
     return NormalizedVector;
 }
 
@@ -203,7 +204,7 @@ Game::Math::Vector2D<T> Game::Math::Vector2D<T> :: ProjectOn(const Game::Math::V
     	Game::Math::Exception::ZeroLengthVector("Vector can't be zero length");
     }
     
-    Game::Math::Vector2D<T> Target_Normalized = Game::Math::Vec2D_Normalize(Target);
+    Game::Math::Vector2D<T> Target_Normalized = Target.Normalize();
 
     double DotProduct = Game::Math::Vec2D_DotProduct(*this, Target_Normalized);
      
@@ -285,9 +286,9 @@ Game::Math::Vector2D<T> Game::Math::Vector2D<T> :: Round(const Game::Math::Vec2D
 template <typename T>
 Game::Math::Vector2D<T> Game::Math::Vector2D<T> :: Lerp(const Game::Math::Vector2D<T>& other, const float t) const
 {
-    T x = x + (other.x - x) * t;
-    T y = y + (other.y - y) * t;
-    return Vector2D<T>(x, y);
+    T lerpX = x + (other.x - x) * t;
+    T lerpY = y + (other.y - y) * t;
+    return Vector2D<T>(lerpX, lerpY);
 }
 
 template <typename T>
@@ -374,7 +375,7 @@ double Game::Math::Vec2D_DotProduct(const Game::Math::Vector2D<T>& v1, const Gam
 template <typename T>
 double Game::Math::Vec2D_CrossProduct(const Game::Math::Vector2D<T>& v1, const Game::Math::Vector2D<T>& v2)
 {
-    return v1.x * v2.x - v1.y * v2.y;
+    return v1.x * v2.y - v1.y * v2.x;
 }
 
 template <typename T>
@@ -440,7 +441,7 @@ Game::Math::Vector2D<T> Game::Math::Vec2D_ProjectOn(const Game::Math::Vector2D<T
     	Game::Math::Exception::ZeroLengthVector("Vector can't be zero length");
     }
     
-    Game::Math::Vector2D<T> Target_Normalized = Game::Math::Vec2D_Normalize(Target);
+    Game::Math::Vector2D<T> Target_Normalized = Target.Normalize();
 
     double DotProduct = Game::Math::Vec2D_DotProduct(Vector, Target_Normalized);
      
@@ -558,3 +559,6 @@ bool Game::Math::Vec2D_IsLessThan(const Game::Math::Vector2D<T>& v1, const Game:
 {
     return v1.Magnitude() < v2.Magnitude();
 }
+
+template struct Game::Math::Vector2D<float>;
+template struct Game::Math::Vector2D<double>;
@@ -12,7 +12,8 @@
 #include "Graphics/Window.hpp"
 #include "Utils/Exceptions/Graphics_Exception.hpp"
  
-Game::Graphics::Window :: Window()
+Game::Graphics::Window :: Window() : window(nullptr), displayMode(), isWindowModal(false), windowId(0), windowFlags(0), windowSize(0, 0),
+    displayIndex(0), windowDisplayMode(), isStateDirty(false)
 {
     
 }
@@ -23,7 +24,8 @@ Game::Graphics::Window :: ~Window()
     window = nullptr;
 }
 
-Game::Graphics::Window :: Window(const char* p_title, int p_w, int p_h) : window(nullptr)
+Game::Graphics::Window :: Window(const char* p_title, int p_w, int p_h) : window(nullptr), displayMode(), isWindowModal(false), windowId(0),
+    windowFlags(0), windowSize(0, 0), displayIndex(0), windowDisplayMode(), isStateDirty(false)
 {
     window = SDL_CreateWindow(p_title, SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, p_w, p_h, SDL_WINDOW_SHOWN);
     
@@ -34,19 +36,25 @@ Game::Graphics::Window :: Window(const char* p_title, int p_w, int p_h) : window
         Game::Graphics::Exception::WindowCreationFailed(FailMessage.c_str());
     }
     
-    SDL_GetWindowPosition(window, &windowPos.x, &windowPos.y);
-    if (SDL_GetCurrentDisplayMode(0, &displayMode) < 0)
-    {
-        std::string FailMessage = "Failed to query display mode: ";
-        FailMessage.append(SDL_GetError());
-        Game::Graphics::Exception::QueryingDisplayModeFailed(FailMessage.c_str());
-    }
+    windowId = SDL_GetWindowID(window);
+    RefreshState();
 }
 
 void Game::Graphics::Window :: Create(const char* p_title, int p_w, int p_h)
 {
+    Create(p_title, p_w, p_h, WindowFlags::None);
+}
+
+void Game::Graphics::Window :: Create(const char* p_title, int p_w, int p_h, WindowFlags flags)
+{
+    Uint32 createFlags = static_cast<Uint32>(flags);
+    if (!(createFlags & SDL_WINDOW_HIDDEN))
+    {
+        createFlags |= SDL_WINDOW_SHOWN;
+    }
+
     window = nullptr;
-    window = SDL_CreateWindow(p_title, SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, p_w, p_h, SDL_WINDOW_SHOWN);
+    window = SDL_CreateWindow(p_title, SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, p_w, p_h, createFlags);
     
     if (window == nullptr)
     {
@@ -55,13 +63,8 @@ void Game::Graphics::Window :: Create(const char* p_title, int p_w, int p_h)
         Game::Graphics::Exception::WindowCreationFailed(FailMessage.c_str());
     }
     
-    SDL_GetWindowPosition(window, &windowPos.x, &windowPos.y);
-    if (SDL_GetCurrentDisplayMode(0, &displayMode) < 0)
-    {
-        std::string FailMessage = "Failed to query display mode: ";
-        FailMessage.append(SDL_GetError());
-        Game::Graphics::Exception::QueryingDisplayModeFailed(FailMessage.c_str());
-    }
+    windowId = SDL_GetWindowID(window);
+    RefreshState();
 }
 
 SDL_DisplayMode Game::Graphics::Window :: CreateDisplayMode(int w, int h, int RefreshRate, Uint32 Format)
@@ -77,22 +80,26 @@ SDL_DisplayMode Game::Graphics::Window :: CreateDisplayMode(int w, int h, int Re
 void Game::Graphics::Window :: SetDisplayMode(SDL_DisplayMode mode)
 {
     SDL_SetWindowDisplayMode(window, &mode);
+    isStateDirty = true;
     Update();
 }
 
 void Game::Graphics::Window :: ResizeWindow(int w, int h)
 {
     SDL_SetWindowSize(window, w, h);
+    isStateDirty = true;
 }
 
 void Game::Graphics::Window :: MoveWindowTo(int x, int y)
 {
     SDL_SetWindowPosition(window, x, y);
+    isStateDirty = true;
 }
 
 void Game::Graphics::Window :: CenterWindow()
 {
     SDL_SetWindowPosition(window, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED);
+    isStateDirty = true;
 }
 
 void Game::Graphics::Window :: Restore()
@@ -127,6 +134,7 @@ void Game::Graphics::Window :: SetWindowResizable(bool resizable)
    }
    
    SDL_SetWindowResizable(window, resizableBool);
+   isStateDirty = true;
 }
 
 void Game::Graphics::Window :: SetWindowOpacity(float opacity)
@@ -150,6 +158,8 @@ void Game::Graphics::Window :: ToggleWindowVisiblity()
     {
         SDL_ShowWindow(window);
     }
+    
+    RefreshFlags();
 }
 
 void Game::Graphics::Window :: ToggleFullscreen()
@@ -163,6 +173,8 @@ void Game::Graphics::Window :: ToggleFullscreen()
     {
         SDL_SetWindowFullscreen(window, SDL_WINDOW_FULLSCREEN);
     }
+    
+    RefreshFlags();
 }
 
 void Game::Graphics::Window :: ToggleBorder()
@@ -176,6 +188,8 @@ void Game::Graphics::Window :: ToggleBorder()
     {
         SDL_SetWindowBordered(window, SDL_FALSE);
     }
+    
+    RefreshFlags();
 }
 
 void Game::Graphics::Window :: ToggleMaximize()
@@ -185,6 +199,8 @@ void Game::Graphics::Window :: ToggleMaximize()
     {
         SDL_MaximizeWindow(window);
     }
+    
+    RefreshFlags();
 }
 
 void Game::Graphics::Window :: ToggleMinimize()
@@ -194,6 +210,8 @@ void Game::Graphics::Window :: ToggleMinimize()
     {
         SDL_MinimizeWindow(window);
     }
+    
+    RefreshFlags();
 }
 
 void Game::Graphics::Window :: RaiseWindow()
@@ -222,13 +240,81 @@ void Game::Graphics::Window :: ShowMessageBox(const char* p_title, const char* m
 
 void Game::Graphics::Window :: Update()
 {
+    // Only goes back to SDL after a call that changed the window, events keep it in sync otherwise
+    if (isStateDirty)
+    {
+        RefreshState();
+    }
+}
+
+bool Game::Graphics::Window :: HandleEvent(const SDL_Event& event)
+{
+    if (event.type == SDL_DISPLAYEVENT)
+    {
+        RefreshDisplayMode();
+        return false;
+    }
+    if (event.type != SDL_WINDOWEVENT || event.window.windowID != windowId)
+    {
+        return false;
+    }
+
+    switch (event.window.event)
+    {
+        case SDL_WINDOWEVENT_MOVED:
+            windowPos.x = event.window.data1;
+            windowPos.y = event.window.data2;
+            break;
+        case SDL_WINDOWEVENT_RESIZED:
+        case SDL_WINDOWEVENT_SIZE_CHANGED:
+            windowSize.first = event.window.data1;
+            windowSize.second = event.window.data2;
+            break;
+        case SDL_WINDOWEVENT_DISPLAY_CHANGED:
+            displayIndex = event.window.data1;
+            RefreshDisplayMode();
+            break;
+        case SDL_WINDOWEVENT_SHOWN:
+        case SDL_WINDOWEVENT_HIDDEN:
+        case SDL_WINDOWEVENT_MINIMIZED:
+        case SDL_WINDOWEVENT_MAXIMIZED:
+        case SDL_WINDOWEVENT_RESTORED:
+        case SDL_WINDOWEVENT_FOCUS_GAINED:
+        case SDL_WINDOWEVENT_FOCUS_LOST:
+            windowFlags = SDL_GetWindowFlags(window);
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+void Game::Graphics::Window :: RefreshState()
+{
+    windowFlags = SDL_GetWindowFlags(window);
     SDL_GetWindowPosition(window, &windowPos.x, &windowPos.y);
-    if (SDL_GetCurrentDisplayMode(0, &displayMode) < 0)
+    SDL_GetWindowSize(window, &windowSize.first, &windowSize.second);
+    displayIndex = SDL_GetWindowDisplayIndex(window);
+    RefreshDisplayMode();
+    isStateDirty = false;
+}
+
+void Game::Graphics::Window :: RefreshFlags()
+{
+    // Toggles read the cached flags, so a second toggle in the same frame must see the first
+    windowFlags = SDL_GetWindowFlags(window);
+    isStateDirty = true;
+}
+
+void Game::Graphics::Window :: RefreshDisplayMode()
+{
+    if (SDL_GetCurrentDisplayMode(displayIndex < 0 ? 0 : displayIndex, &displayMode) < 0)
     {
         std::string FailMessage = "Failed to query display mode: ";
         FailMessage.append(SDL_GetError());
         Game::Graphics::Exception::QueryingDisplayModeFailed(FailMessage.c_str());
     }
+    windowDisplayMode = GetDisplayMode(displayIndex, 0);
 }
 
 SDL_Window* Game::Graphics::Window :: GetWindow() const 
@@ -238,31 +324,25 @@ SDL_Window* Game::Graphics::Window :: GetWindow() const
 
 Uint32 Game::Graphics::Window :: GetWindowFlags() const
 {
-    return SDL_GetWindowFlags(window);
+    return windowFlags;
 }
 
 Game::Math::Point2D<int> Game::Graphics::Window :: GetWindowCenter() const
 {
-    Game::Math::Point2D<int> CentrePos, WindowSize;
-    SDL_GetWindowSize(window, &WindowSize.x, &WindowSize.y);
-    CentrePos.x = WindowSize.x / 2;
-    CentrePos.y = WindowSize.y / 2;
+    Game::Math::Point2D<int> CentrePos;
+    CentrePos.x = windowSize.first / 2;
+    CentrePos.y = windowSize.second / 2;
     return CentrePos;
 }
 
 Game::Math::Pair<int, int> Game::Graphics::Window :: GetWindowSize() const
 {
-    Game::Math::Pair<int, int> WindowSize;
-    SDL_GetWindowSize(window, &WindowSize.first, &WindowSize.second);
-    return WindowSize;
+    return windowSize;
 }
 
 SDL_DisplayMode Game::Graphics::Window ::GetCurrentDisplayMode() const
 {
-    int displayIndex = SDL_GetWindowDisplayIndex(0);
-    SDL_DisplayMode mode;
-    SDL_GetCurrentDisplayMode(displayIndex, &mode);
-    return mode;
+    return displayMode;
 }
 
 SDL_DisplayMode Game::Graphics::Window ::GetDisplayMode(int displayIndex, int modeIndex) const
@@ -274,32 +354,28 @@ SDL_DisplayMode Game::Graphics::Window ::GetDisplayMode(int displayIndex, int mo
 
 SDL_DisplayMode Game::Graphics::Window :: GetWindowDisplayMode() const
 {
-    int displayIndex = GetWindowDisplayIndex();
-    SDL_DisplayMode mode = GetDisplayMode(displayIndex, 0);
-    return mode;
+    return windowDisplayMode;
 }
 
 
 Uint32 Game::Graphics::Window :: GetWindowFormat() const
 {
-    SDL_DisplayMode mode = GetWindowDisplayMode();
-    return mode.format;
+    return windowDisplayMode.format;
 }
 
 int Game::Graphics::Window :: GetWindowDisplayIndex() const
 {
-    return SDL_GetWindowDisplayIndex(window);
+    return displayIndex;
 }
 
 int Game::Graphics::Window :: GetRefreshRate() const
 {
-    SDL_DisplayMode mode = GetWindowDisplayMode();
-    return mode.refresh_rate;
+    return windowDisplayMode.refresh_rate;
 }
 
 bool Game::Graphics::Window :: IsWindowOpen() const
 {
-    return SDL_GetWindowFlags(window) & SDL_WINDOW_SHOWN;
+    return windowFlags & SDL_WINDOW_SHOWN;
 }
 
 bool Game::Graphics::Window :: HasError() const
@@ -0,0 +1,46 @@
+/**
+ *  \file DeterminismTest.cpp
+ *
+ *  \brief Checks that RigidBodyWorld gives the same state hash on every step
+ *  single threaded and with worker threads in deterministic mode.
+ *
+ *  Usage: DeterminismTest [workerCount]
+ *
+ *  \author IndieGameSmith
+ *  \date 2026-10-18
+ */
+
+#include "Physics/RigidBodyWorld.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+constexpr size_t DETERMINISM_BODY_COUNT = 400;
+constexpr size_t DETERMINISM_STEP_COUNT = 300;
+constexpr size_t DETERMINISM_MIN_WORKER_COUNT = 4;
+
+int main(int argc, char* argv[])
+{
+    // At least a few workers so the split is exercised on small machines too
+    size_t workerCount = std::max<size_t>(std::thread::hardware_concurrency(), DETERMINISM_MIN_WORKER_COUNT);
+    if (argc > 1)
+    {
+        workerCount = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    if (!Game::Physics::Physics_DeterminismCheck(DETERMINISM_BODY_COUNT, DETERMINISM_STEP_COUNT, 0))
+    {
+        std::cerr << "DeterminismTest: 0 workers failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (!Game::Physics::Physics_DeterminismCheck(DETERMINISM_BODY_COUNT, DETERMINISM_STEP_COUNT, workerCount))
+    {
+        std::cerr << "DeterminismTest: " << workerCount << " workers failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "DeterminismTest: 0 and " << workerCount << " workers matched over " << DETERMINISM_STEP_COUNT << " steps" << std::endl;
+    return EXIT_SUCCESS;
+}